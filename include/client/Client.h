@@ -29,6 +29,7 @@
 #include "Connector.h"
 #include "Objects.h"
 #include "OramAccessController.h"
+#include <crypto/aead.h>
 #include <proto/seal.grpc.pb.h>
 #include <proto/seal.pb.h>
 
@@ -84,8 +85,14 @@ private:
 
     std::string secret_key; // for pseudo-random permutation
 
+    std::unique_ptr<AeadCipher> cipher; // keyed with secret_key once.
+
+    std::string bucket_key; // seals the buckets of every ORAM, derived from secret_key.
+
     std::vector<std::unique_ptr<OramAccessController>> adj_oramAccessControllers;
 
+    std::string adj_map_key; // the column of adj_oramAccessControllers, to which their documents are bound.
+
     std::map<std::string, std::vector<std::unique_ptr<OramAccessController>>> adj_oramAccessControllers_range;
 
     size_t memory_size;
@@ -112,6 +119,41 @@ private:
      */
     void init_key(std::string_view password);
 
+    /**
+     * @brief Compute the block size of the oblivious dictionary, which must hold the largest sealed node.
+     * 
+     * @param key_size the length of the longest key in the index.
+     * @param data_size the length of the longest data in the index.
+     * @return the larger of block_size and the largest node.
+     */
+    size_t odict_block_size(const size_t& key_size, const size_t& data_size) const;
+
+    /**
+     * @brief Seal the key and the data of a node together into its data field, bound to its id.
+     */
+    void seal_node(ODict::Node& node) const;
+
+    /**
+     * @brief Reverse seal_node for the node read at address id.
+     * 
+     * @throw std::runtime_error if the node was not sealed by this client for this id.
+     */
+    void open_node(ODict::Node& node, const int& id) const;
+
+    /**
+     * @brief Encrypt a document into a block of a sub-ORAM, bound to its column, the sub-ORAM and its index there.
+     */
+    std::string seal_document(
+        const SEAL::Document& document, const std::string& map_key, const unsigned int& oram_id, const int& index) const;
+
+    /**
+     * @brief Reverse seal_document for the block read at index of the sub-ORAM.
+     * 
+     * @throw std::runtime_error if the block was not sealed by this client for this place.
+     */
+    SEAL::Document open_document(
+        const std::string& block, const std::string& map_key, const unsigned int& oram_id, const int& index) const;
+
     /**
      * @param op contains
      *                   > @param data the data to be read (dummy) or to be written.
@@ -364,7 +406,8 @@ public:
      * 
      * @param bucket_size the size of each oram bucket.
      * @param block_number how many blocks should one bucket hold
-     * @param block_size the length of one block. @note Should set to sizeof(ODict::node)
+     * @param block_size the minimum length of one block of the oblivious dictionary. @note The block grows
+     *                   to fit the largest node once the index is built, so 0 sizes it from the data alone.
      * @param odict_size the approximate size of the obilivious data structure.
      * @param max_size the maximum size of the client cache.
      * @param password the password for encryption / decryption
@@ -29,8 +29,13 @@
 
 class OramAccessController {
 private:
+    friend class OramAccessScheduler;
+
     UntrustedStorageInterface* storage;
 
+    /**
+     * @brief The leaf sampler of this ORAM alone, freed with it.
+     */
     RandForOramInterface* random;
 
     OramInterface* oram;
@@ -46,6 +51,12 @@ private:
 
     Seal::Stub* stub_;
 
+    /**
+     * @brief Turn a batch of accesses into the operations of the ORAM, moving out the data to be written.
+     */
+    std::vector<OramInterface::BatchOperation> make_batch(
+        OramAccessOp op, const std::vector<int>& addresses, std::vector<std::string>& data);
+
 public:
     /**
      * @brief Get the random engine to initialize the random engine on the remote server side. 
@@ -64,6 +75,15 @@ public:
      */
     void oblivious_access(OramAccessOp op, const int& address, std::string& data);
 
+    /**
+     * @brief Access several blocks at once. The paths are read together and evicted in one write.
+     * 
+     * @param op the operation: READ / WRITE.
+     * @param addresses the physical addresses.
+     * @param data the data to be written, or the data read, one for each address.
+     */
+    void oblivious_access_batch(OramAccessOp op, const std::vector<int>& addresses, std::vector<std::string>& data);
+
     /**
      * @brief The normal way to access the PathORAM.
      * @note reserved.
@@ -94,6 +114,11 @@ public:
      */
     void oblivious_access_direct(OramAccessOp op, unsigned char* data, Seal::Stub* stub_);
 
+    /**
+     * @brief Wait for the writes that the accesses left in flight, and report the error of any that failed.
+     */
+    void flush();
+
     /**
      * @brief Sample a new position in advance for oblivious data sturctures.
      * 
@@ -111,11 +136,48 @@ public:
      * @param is_odict Is this oram served as oblivious dictionary.
      * @param key Used to look up the storage on the server side.
      * @param stub_ Interfaces to the server.
+     * @param oram_type The ORAM engine behind this controller.
+     * @param position_map_threshold If non-zero, the position map is stored recursively in smaller ORAMs on the
+     *                               server until one has at most this many blocks. Zero keeps it on the client.
+     * @param tree_top_levels The number of levels at the top of the tree cached on the client.
+     * @param async_write Return right after the path read and write the path back in the background.
+     * @param use_session Send the bucket operations over one stream to the server instead of a call for each.
+     * @param in_flight_window If non-zero, the buckets are accessed through an AsyncServerStorage with up to this
+     *                         many requests in flight, instead of async_write and use_session. The writes of an
+     *                         access overlap with each other and with the next access, which reports their errors.
+     * @param bucket_key If not empty, the buckets are sealed on the client under this key before they reach the
+     *                   server (@see EncryptedStorage), and so are those of a recursive position map. Only for
+     *                   Path and Circuit ORAM: a sealed bucket is opened whole, which would cost Ring ORAM its
+     *                   single block per bucket on the read path.
+     * @throw std::runtime_error if bucket_key is set for Ring ORAM.
      */
     OramAccessController(
         const int& bucket_size, const int& block_number, const int& block_size,
         const int& oram_id, const bool& is_odict, const std::string& key,
-        Seal::Stub* stub_ = nullptr);
+        Seal::Stub* stub_ = nullptr, const OramType& oram_type = ORAM_TYPE_PATH,
+        const unsigned int& position_map_threshold = 0, const int& tree_top_levels = 0,
+        const bool& async_write = false, const bool& use_session = false, const size_t& in_flight_window = 0,
+        const std::string& bucket_key = "");
+
+    /**
+     * @brief Build the ORAM from a known dataset, which is packed locally and streamed to the server in chunks.
+     * 
+     * @param blocks pairs of address and data, with distinct addresses.
+     * @see The constructor above for the other parameters.
+     */
+    OramAccessController(
+        const int& bucket_size, const int& block_number, const int& block_size,
+        const int& oram_id, const bool& is_odict, const std::string& key,
+        const std::vector<std::pair<unsigned int, std::string>>& blocks,
+        Seal::Stub* stub_ = nullptr, const OramType& oram_type = ORAM_TYPE_PATH,
+        const unsigned int& position_map_threshold = 0, const int& tree_top_levels = 0,
+        const bool& async_write = false, const bool& use_session = false, const size_t& in_flight_window = 0,
+        const std::string& bucket_key = "");
+
+    /**
+     * @brief Write back whatever the storage still holds, then free the ORAM and the storage.
+     */
+    ~OramAccessController();
 
     void set_stub(Seal::Stub* stub_);
 };
@@ -0,0 +1,121 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ORAM_ACCESS_SCHEDULER_H_
+#define ORAM_ACCESS_SCHEDULER_H_
+
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "OramAccessController.h"
+
+/**
+ * @brief Marks a batch whose buckets are not read by the vectored request.
+ */
+#define NO_READ (-1)
+
+/**
+ * @brief Gathers the batched accesses of one query phase on several ORAMs, so that they share their round trips.
+ *
+ * Every ORAM whose storage is vectored reads its buckets in one vectored_access call and writes them back in
+ * another, whatever the number of ORAMs; sealed buckets and tree-top caches are handled by their storages. The
+ * others, e.g. those with requests in flight of their own, start their reads before any read is waited for, and
+ * leave their writes in flight to overlap the next accesses.
+ */
+class OramAccessScheduler {
+private:
+    /**
+     * @brief The accesses scheduled on one ORAM.
+     */
+    struct Schedule {
+        /**
+         * @brief How far the batch went, so that a failed execute resumes it instead of remapping it again.
+         */
+        enum Stage {
+            SCHEDULED,
+            BEGUN,
+            FINISHED,
+            WRITTEN
+        };
+
+        Stage stage = SCHEDULED;
+
+        std::vector<OramInterface::BatchOperation> ops;
+
+        /**
+         * @brief Where the results of each scheduled batch go, with the number of operations it has.
+         */
+        std::vector<std::pair<std::vector<std::string>*, size_t>> outputs;
+
+        /**
+         * @brief The buckets that the batch reads and writes back.
+         */
+        std::vector<int> positions;
+
+        /**
+         * @brief The index of the read of the batch in the vectored request, if it is part of it.
+         */
+        int read = NO_READ;
+
+        /**
+         * @brief The read of the batch that the storage runs on its own, if it is not part of the vectored request.
+         */
+        std::future<std::vector<Bucket>> pending;
+
+        /**
+         * @brief The buckets that the batch writes back, kept until they are written.
+         */
+        std::vector<Bucket> evicted;
+
+        std::vector<std::string> results;
+    };
+
+    Seal::Stub* stub_;
+
+    std::map<OramAccessController*, Schedule> schedules;
+
+public:
+    OramAccessScheduler(Seal::Stub* stub_);
+
+    /**
+     * @brief Schedule a batch of accesses on an ORAM, in the same way as oblivious_access_batch.
+     *
+     * Several batches on the same ORAM are merged into one.
+     *
+     * @param data the data to be written, or the data read once the accesses are executed. It must outlive execute.
+     * @throw std::runtime_error if the ORAM has a batch left by a failed execute.
+     */
+    void schedule(
+        OramAccessController* controller, OramAccessOp op, const std::vector<int>& addresses,
+        std::vector<std::string>& data);
+
+    /**
+     * @brief Perform all the scheduled accesses and clear the schedule.
+     *
+     * Every batch is checked before any ORAM is remapped. Once remapped, the blocks of a batch are only reachable
+     * through the paths it reads and writes back, so if a round trip fails the schedule is kept and calling execute
+     * again resumes every batch where it stopped. Until then, the ORAMs of the schedule must not be accessed.
+     *
+     * @throw std::runtime_error if a batch is invalid, in which case nothing is done and the new batches are dropped,
+     *        or if the server fails to read or write the buckets.
+     */
+    void execute();
+};
+
+#endif
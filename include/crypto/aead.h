@@ -0,0 +1,74 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef AEAD_H_
+#define AEAD_H_
+
+#include <string>
+
+/* XChaCha20-Poly1305: a random 24-byte nonce in front of the ciphertext and a 16-byte tag after it. */
+#define AEAD_NONCE_BYTES 24
+#define AEAD_TAG_BYTES 16
+#define AEAD_OVERHEAD (AEAD_NONCE_BYTES + AEAD_TAG_BYTES)
+
+/* Context under which keys are derived from the client's secret key, and the ids of those keys. */
+#define AEAD_KDF_CONTEXT "SEALAEAD"
+#define AEAD_KDF_SUBKEY_ID 1
+#define BUCKET_KDF_SUBKEY_ID 2
+
+/**
+ * @brief Binary authenticated encryption of node data and documents.
+ * 
+ * A sealed buffer is nonce || ciphertext || tag, i.e. AEAD_OVERHEAD bytes larger than the plaintext,
+ * with no padding and no base64. Every seal draws a fresh random nonce.
+ */
+class AeadCipher {
+private:
+    unsigned char key[32];
+
+public:
+    /**
+     * @brief Derive the AEAD key from a 32-byte master key.
+     */
+    explicit AeadCipher(const std::string& raw_key);
+
+    ~AeadCipher();
+
+    static size_t sealed_size(const size_t& plaintext_size);
+
+    /**
+     * @brief Encrypt in place.
+     * 
+     * @param buffer holds the plaintext at buffer + AEAD_NONCE_BYTES and has room for sealed_size(plaintext_size) bytes.
+     * @param associated_data authenticated but not encrypted; the same bytes must be given to open.
+     */
+    void seal(unsigned char* buffer, const size_t& plaintext_size, const std::string& associated_data = "") const;
+
+    /**
+     * @brief Decrypt in place; the plaintext is left at buffer + AEAD_NONCE_BYTES.
+     * 
+     * @return the size of the plaintext.
+     * @throw std::runtime_error if the buffer is not a sealed buffer of this key and associated data.
+     */
+    size_t open(unsigned char* buffer, const size_t& sealed_size, const std::string& associated_data = "") const;
+
+    std::string encrypt(const std::string& ptext, const std::string& associated_data = "") const;
+
+    std::string decrypt(const std::string& ctext, const std::string& associated_data = "") const;
+};
+
+#endif
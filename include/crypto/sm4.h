@@ -18,13 +18,19 @@
 #ifndef SM4_H_
 #define SM4_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #define SM4_ENCRYPT 1
 #define SM4_DECRYPT 0
 
 #define AES_BLOCK_BYTES 16
 
+/* Number of blocks the AVX2 kernel encrypts side by side. */
+#define SM4_AVX2_LANES 8
+
 std::string
 decrypt_SM4_EBC(const std::string& ctext, const std::string& raw_key);
 
@@ -84,6 +90,50 @@ void sm4_crypt_cbc(sm4_context* ctx,
 }
 #endif
 
+/**
+ * @brief An SM4 cipher keyed once and reused for every encryption / decryption.
+ * 
+ * The round keys for both directions are derived at construction. Blocks are handed to the
+ * fastest kernel the CPU supports: an AVX2 kernel that runs SM4_AVX2_LANES blocks at once,
+ * or a table-driven one otherwise. Define SM4_DISABLE_AVX2 to always use the latter.
+ */
+class SM4Cipher {
+private:
+    uint32_t rk_enc[32];
+
+    uint32_t rk_dec[32];
+
+public:
+    /**
+     * @brief Derive the round keys from the first 16 bytes of raw_key (zero-padded if shorter).
+     */
+    explicit SM4Cipher(const std::string& raw_key);
+
+    /**
+     * @brief ECB over whole blocks; input and output may alias.
+     * 
+     * @param blocks number of 16-byte blocks
+     */
+    void encrypt_blocks(const unsigned char* input, unsigned char* output, const size_t& blocks) const;
+
+    void decrypt_blocks(const unsigned char* input, unsigned char* output, const size_t& blocks) const;
+
+    /**
+     * @brief Same format as encrypt_SM4_EBC: padded, ECB-encrypted and base64-encoded.
+     */
+    std::string encrypt(const std::string& ptext) const;
+
+    std::string decrypt(const std::string& ctext) const;
+
+    /**
+     * @brief Encrypt a batch of buffers with a single pass of the kernel, so that short
+     *        buffers still fill the vector lanes.
+     */
+    std::vector<std::string> encrypt(const std::vector<std::string>& ptexts) const;
+
+    std::vector<std::string> decrypt(const std::vector<std::string>& ctexts) const;
+};
+
 template <typename SIZE_T>
 static SIZE_T
 getBlocks(unsigned int unit, SIZE_T len)
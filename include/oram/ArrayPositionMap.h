@@ -0,0 +1,54 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_ARRAYPOSITIONMAP_H
+#define PORAM_ARRAYPOSITIONMAP_H
+
+#include <cstdint>
+#include <vector>
+
+#include "PositionMapInterface.h"
+#include "RandForOramInterface.h"
+
+/**
+ * @brief A position map kept on the client as a packed, preallocated array of leaves (4 bytes per block).
+ */
+class ArrayPositionMap : public PositionMapInterface {
+private:
+    std::vector<uint32_t> leaves;
+
+    void check_bound(const unsigned int& block_index);
+
+public:
+    /**
+     * @brief The constructor for the ArrayPositionMap class.
+     *
+     * @param num_blocks The number of blocks in the ORAM.
+     * @param rand_gen Every block is mapped to a random leaf sampled from it.
+     */
+    ArrayPositionMap(const unsigned int& num_blocks, RandForOramInterface* rand_gen);
+
+    unsigned int get(const unsigned int& block_index);
+
+    void set(const unsigned int& block_index, const unsigned int& leaf);
+
+    unsigned int exchange(const unsigned int& block_index, const unsigned int& leaf);
+
+    unsigned int size();
+};
+
+#endif //PORAM_ARRAYPOSITIONMAP_H
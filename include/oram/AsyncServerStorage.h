@@ -0,0 +1,215 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_ASYNCSERVERSTORAGE_H
+#define PORAM_ASYNCSERVERSTORAGE_H
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "ServerStorage.h"
+#include "UntrustedStorageInterface.h"
+
+#include <grpc++/completion_queue.h>
+#include <proto/seal.grpc.pb.h>
+#include <proto/seal.pb.h>
+
+/**
+ * @brief The default number of requests that an AsyncServerStorage keeps in flight.
+ */
+#define ASYNC_WINDOW 16
+
+/**
+ * @brief A server storage whose bucket operations return futures, so that the accesses of independent ORAMs and
+ *        the eviction writes overlap on one connection.
+ *
+ * Up to a window of requests are in flight at once, and their completions are handled by a thread of the storage.
+ * The server may run concurrent requests in any order, so a bucket being written is read from the pending write,
+ * and a write waits until no request in flight touches its buckets. The blocking interface is built on top of
+ * the futures: reads wait for their result, while writes return at once, so that the eviction of an access overlaps
+ * the next one. A failed write reports its error to the first request after it has completed, or to flush.
+ */
+class AsyncServerStorage : public UntrustedStorageInterface {
+private:
+    /**
+     * @brief A request in flight, which is its own tag on the completion queue.
+     */
+    struct Call {
+        grpc::ClientContext context;
+
+        grpc::Status status;
+
+        std::vector<int> reads;
+
+        std::vector<int> writes;
+
+        /**
+         * @brief Fulfil the future of the request.
+         * @param ok whether the completion queue delivered the response.
+         */
+        virtual void complete(const bool& ok) = 0;
+
+        virtual ~Call() {};
+    };
+
+    template <typename Response, typename Result>
+    struct ResponseCall;
+
+    /**
+     * @brief Registers the storage on the server and loads the tree, which are not on the hot path.
+     */
+    ServerStorage control;
+
+    Seal::Stub* const stub_;
+
+    uint64_t handle;
+
+    const size_t window;
+
+    int capacity;
+
+    int num_levels;
+
+    int block_size;
+
+    grpc::CompletionQueue cq;
+
+    std::thread completion_thread;
+
+    /**
+     * @brief Guards the bookkeeping of the requests in flight below.
+     */
+    std::mutex call_lock;
+
+    std::condition_variable call_done;
+
+    size_t in_flight;
+
+    /**
+     * @brief The buckets being written by position.
+     */
+    std::unordered_map<int, Bucket> pending_buckets;
+
+    /**
+     * @brief The number of reads in flight of each bucket.
+     */
+    std::unordered_map<int, int> reading;
+
+    /**
+     * @brief The writes of the blocking interface, whose errors are not reported yet.
+     */
+    std::list<std::future<void>> detached_writes;
+
+    void check_position(const int& position);
+
+    /**
+     * @brief Report the error of a write of the blocking interface that has completed since the last request.
+     */
+    void check_writes();
+
+    void check_path(const int& leaf, const int& start_level);
+
+    /**
+     * @brief Handle the completions until the queue is shut down.
+     */
+    void complete_calls();
+
+    /**
+     * @brief Start a request. The caller holds the call lock and has waited for room in the window.
+     *
+     * @param start starts the RPC on the completion queue of the storage.
+     * @param reads the buckets that the request reads.
+     * @param writes the buckets that the request writes, which are served from buckets_to_write meanwhile.
+     * @param parse turns the response into the result of the future.
+     */
+    template <typename Response, typename Result>
+    std::future<Result> issue(
+        const std::function<std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>(grpc::ClientContext*)>& start,
+        const std::vector<int>& reads, const std::vector<int>& writes, const std::vector<Bucket>& buckets_to_write,
+        const std::function<Result(Response&)>& parse);
+
+    /**
+     * @brief Whether none of the buckets is read or written by a request in flight.
+     */
+    bool can_write(const std::vector<int>& positions);
+
+    /**
+     * @brief Get the number of levels from start_level on that can be served from the pending writes, or -1 if
+     *        the pending buckets on the path do not form a prefix of it.
+     */
+    int pending_prefix(const int& leaf, const int& start_level);
+
+    /**
+     * @brief Keep the future of a write of the blocking interface until it is reported by check_writes or flush.
+     */
+    void detach(std::future<void> write);
+
+public:
+    /**
+     * @brief The constructor for the AsyncServerStorage class.
+     *
+     * @see ServerStorage for the first parameters.
+     * @param window The largest number of requests in flight.
+     */
+    AsyncServerStorage(
+        const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub* stub_,
+        const size_t& window = ASYNC_WINDOW);
+
+    ~AsyncServerStorage();
+
+    void setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size);
+
+    std::future<Bucket> ReadBucketAsync(const int& position);
+
+    std::future<void> WriteBucketAsync(const int& position, const Bucket& bucket_to_write);
+
+    std::future<std::vector<Bucket>> ReadPathAsync(const int& leaf, const int& start_level = 0);
+
+    std::future<void> WritePathAsync(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0);
+
+    std::future<std::vector<Block>> ReadBlocksAsync(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0);
+
+    std::future<std::vector<Bucket>> ReadBucketsAsync(const std::vector<int>& positions);
+
+    std::future<void> WriteBucketsAsync(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    Bucket ReadBucket(const int& position);
+
+    void WriteBucket(const int& position, const Bucket& bucket_to_write);
+
+    std::vector<Bucket> ReadPath(const int& leaf, const int& start_level = 0);
+
+    void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0);
+
+    std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0);
+
+    std::vector<Bucket> ReadBuckets(const std::vector<int>& positions);
+
+    void WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    void LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write);
+
+    void flush();
+};
+
+#endif
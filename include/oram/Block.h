@@ -18,26 +18,29 @@
 #ifndef PORAM_BLOCK_H
 #define PORAM_BLOCK_H
 
-#include <algorithm>
-#include <vector>
-
-#include <cereal/access.hpp>
-#include <cereal/archives/binary.hpp>
-#include <cereal/types/string.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 
 #define BLOCK_SIZE 2
 
-class Block {
-    /**
-     * Intrusive serialize helper. The interface is the same as what is provided by the boost libarary.
-     */
-    friend class cereal::access;
-    template <class Archive>
-    void serialize(Archive& ar)
-    {
-        ar(leaf_id, index, data);
-    }
+/**
+ * @brief The header of a slot in the fixed-size bucket format.
+ *
+ * A slot is the header followed by block_size bytes of payload, of which the first length bytes hold the data.
+ * A dummy slot has index -1. A bucket is its slots back to back, so its size only depends on Z and block_size.
+ */
+struct SlotHeader {
+    int32_t leaf_id;
+
+    int32_t index;
 
+    uint32_t length;
+};
+
+static_assert(sizeof(SlotHeader) == 12, "A slot header is sent as is and must have no padding.");
+
+class Block {
 public:
     /**
      * @brief To which leaf it belongs.
@@ -50,7 +53,7 @@ public:
     int index;
 
     /**
-     * @brief Variable data.
+     * @brief Variable data, at most block_size bytes once it is stored in a bucket.
      * @note To store class object as a string, use the serialize helper provided by the util header.
      */ 
     std::string data;
@@ -59,10 +62,38 @@ public:
 
     Block(const Block& block);
 
+    Block(Block&& block) noexcept;
+
+    Block& operator=(const Block& block) = default;
+
+    Block& operator=(Block&& block) noexcept = default;
+
     Block(const int& leaf_id, const int& index, const std::string& data);
 
     void printBlock();
 
+    /**
+     * @brief The number of bytes taken by a slot whose payload holds up to block_size bytes.
+     */
+    static size_t slot_size(const size_t& block_size);
+
+    /**
+     * @brief Encode the block into a slot, padding the payload with zeros.
+     * @throw std::length_error if the data is larger than the block size.
+     */
+    void write_slot(char* slot, const size_t& block_size) const;
+
+    /**
+     * @brief Decode the block stored in a slot.
+     * @throw std::length_error if the header claims more data than the payload holds.
+     */
+    static Block read_slot(const char* slot, const size_t& block_size);
+
+    /**
+     * @brief Read the header of a slot without decoding its payload.
+     */
+    static SlotHeader read_header(const char* slot);
+
     virtual ~Block();
 };
 
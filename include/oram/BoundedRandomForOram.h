@@ -0,0 +1,45 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_BOUNDEDRANDOMFORORAM_H
+#define PORAM_BOUNDEDRANDOMFORORAM_H
+
+#include "RandForOramInterface.h"
+
+#include <csprng.hpp>
+
+/**
+ * @brief A leaf sampler with its own bound.
+ *
+ * RandomForOram is a singleton with a global bound, so each ORAM owns one of these instead: the controllers, whose
+ * ORAMs differ in size, as well as the levels of a recursive position map inside them.
+ */
+class BoundedRandomForOram : public RandForOramInterface {
+private:
+    int bound;
+
+    duthomhas::csprng rng;
+
+public:
+    BoundedRandomForOram();
+
+    int getRandomLeaf();
+
+    void setBound(int num_leaves);
+};
+
+#endif //PORAM_BOUNDEDRANDOMFORORAM_H
@@ -19,39 +19,68 @@
 #define PORAM_BUCKET_H
 
 #include <stdexcept>
+#include <string>
 #include <vector>
 
-#include <cereal/access.hpp>
-#include <cereal/types/vector.hpp>
-
 #include "Block.h"
 
 using namespace std;
 
+/**
+ * @brief A bucket in the fixed-size slot format (@see SlotHeader).
+ *
+ * The slots are stored back to back in one buffer, which is sent to the server and stored there as is;
+ * blocks are only decoded on the client when they are taken out of the bucket.
+ */
 class Bucket {
-    friend class cereal::access;
-    template <class Archive>
-    void serialize(Archive& ar)
-    {
-        ar(is_init, max_size, blocks);
-    }
-
 public:
     Bucket();
-    Bucket(Bucket* other);
-    Block getBlockByIndex(int index);
-    void addBlock(Block new_blk);
-    bool removeBlock(Block rm_blk);
-    vector<Block> getBlocks();
-    static void setMaxSize(int maximumSize);
-    static void resetState();
-    static int getMaxSize();
+
+    /**
+     * @brief A bucket of dummy slots.
+     */
+    Bucket(const size_t& num_slots, const size_t& block_size);
+
+    /**
+     * @brief Encode the blocks, one per slot.
+     */
+    Bucket(const vector<Block>& blocks, const size_t& block_size);
+
+    /**
+     * @brief Adopt a buffer in the slot format, e.g. one received from the server.
+     * @throw std::length_error if the buffer is not a whole number of slots.
+     */
+    Bucket(std::string&& buffer, const size_t& block_size);
+
+    /**
+     * @brief The number of slots.
+     */
+    size_t size() const;
+
+    size_t getBlockSize() const;
+
+    SlotHeader getHeaderAt(int offset) const;
+
+    //Get block object stored in the given slot
+    Block getBlockAt(int offset) const;
+
+    void setBlockAt(int offset, const Block& block);
+
+    vector<Block> getBlocks() const;
+
+    // Decode every slot, leaving the bucket empty.
+    vector<Block> takeBlocks();
+
+    const std::string& getBuffer() const;
+
     void printBlocks();
 
 private:
-    static bool is_init; //should be initially false
-    static int max_size; //should be initially -1
-    vector<Block> blocks;
+    std::string buffer;
+
+    size_t block_size;
+
+    void check_offset(const int& offset) const;
 };
 
 #endif //PORAM_BUCKET_H
@@ -0,0 +1,151 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_CIRCUITORAM_H
+#define PORAM_CIRCUITORAM_H
+
+#include <cmath>
+#include <vector>
+
+#include "OramInterface.h"
+#include "PositionMapInterface.h"
+#include "RandForOramInterface.h"
+#include "Stash.h"
+#include "UntrustedStorageInterface.h"
+
+/**
+ * @brief Circuit ORAM (Wang et al., CCS'15).
+ *
+ * An access reads the path of the requested block, removes the block from it and writes the path
+ * back. Two paths chosen in reverse lexicographic order are then evicted. Each eviction first scans
+ * the block metadata on the path to decide which block every level should pick up, and then moves
+ * at most one block per level towards the leaf in a single root-to-leaf pass. This keeps the stash
+ * at a small constant size even with Z = 2 or 3.
+ *
+ * @note The stash is bounded by stash_limit; exceeding it throws and should never happen in practice.
+ */
+class CircuitOram : public OramInterface {
+private:
+    /**
+     * @brief Reject data that does not fit in a slot before the access changes any state.
+     */
+    void check_data_size(const std::string& data);
+
+    std::string access_handler(
+        Operation op, const unsigned int& blockIndex,
+        const int& oldLeaf, const int& newLeaf, const std::string& newdata);
+
+    /**
+     * @brief Read the path to the leaf and move the requested block (if any) to the stash.
+     */
+    void read_and_remove(const int& leaf, const unsigned int& blockIndex);
+
+    /**
+     * @brief Evict the stash onto the next path in reverse lexicographic order.
+     */
+    void evict_once();
+
+    /**
+     * @brief Get the deepest level (offset by one, 0 being the stash) a block may reach on the path.
+     */
+    int reachable_level(const Block& block, const int& leaf);
+
+    /**
+     * @brief Find the real block in the blocks that may go deepest on the path.
+     * @return the offset of the block, -1 if there is no real block.
+     */
+    int deepest_block(const std::vector<Block>& blocks, const int& leaf, int& level);
+
+public:
+    UntrustedStorageInterface* storage;
+
+    RandForOramInterface* rand_gen;
+
+    unsigned int bucket_size;
+
+    /**
+     * @brief The size of the payload of a slot, i.e. the largest data a block may hold.
+     */
+    unsigned int block_size;
+
+    unsigned int stash_limit;
+
+    unsigned int num_levels;
+
+    unsigned int num_leaves;
+
+    unsigned int num_blocks;
+
+    unsigned int num_buckets;
+
+    unsigned int eviction_counter;
+
+    PositionMapInterface* position_map;
+
+    Stash stash;
+
+    /**
+     * @brief The constructor of the CircuitOram class.
+     *
+     * @param bucket_size the number of slots in a bucket (Z), usually 2 to 4.
+     * @param position_map the position map, owned by the ORAM. A client-side ArrayPositionMap is used if it is null.
+     * @param stash_limit the maximum number of blocks the stash may hold between accesses.
+     */
+    CircuitOram(
+        UntrustedStorageInterface* storage,
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const unsigned int& block_size = BLOCK_SIZE,
+        PositionMapInterface* position_map = nullptr,
+        const unsigned int& stash_limit = 64);
+
+    /**
+     * @brief Build the ORAM from a known dataset instead of writing every block with an access.
+     *
+     * @param blocks pairs of block index and data, with distinct indices.
+     * @see OramReadPathEviction
+     */
+    CircuitOram(
+        UntrustedStorageInterface* storage,
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+        const unsigned int& block_size = BLOCK_SIZE, PositionMapInterface* position_map = nullptr,
+        const unsigned int& stash_limit = 64);
+
+    ~CircuitOram();
+
+    std::string access(Operation op, const unsigned int& blockIndex, const std::string& new_data);
+
+    std::string access_direct(Operation op, const std::string& new_data);
+
+    int P(int leaf, int level);
+
+    int* getPositionMap();
+
+    vector<Block> getStash();
+
+    int getStashSize();
+
+    int getNumLeaves();
+
+    int getNumLevels();
+
+    int getNumBlocks();
+
+    int getNumBuckets();
+};
+
+#endif
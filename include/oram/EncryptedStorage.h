@@ -0,0 +1,127 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_ENCRYPTEDSTORAGE_H
+#define PORAM_ENCRYPTEDSTORAGE_H
+
+#include <future>
+#include <string>
+#include <vector>
+
+#include "UntrustedStorageInterface.h"
+#include <crypto/sm4.h>
+
+/* A sealed bucket starts with the nonce of its keystream and the tag of its ciphertext. */
+#define BUCKET_NONCE_BYTES 12
+#define BUCKET_TAG_BYTES 16
+#define BUCKET_OVERHEAD (BUCKET_NONCE_BYTES + BUCKET_TAG_BYTES)
+
+/**
+ * @brief Encrypts whole buckets before they are handed to another storage, so that the server sees neither the
+ *        slot headers (leaf ids, indices, dummy markers) nor the payloads.
+ *
+ * Every write seals the bucket under a fresh random nonce with SM4 in counter mode; the keystream of all the
+ * buckets of a call is produced in one pass of the bulk SM4 kernel. The first two keystream blocks key a
+ * Poly1305 tag over the context, the position and the ciphertext, so a bucket cannot be altered or moved.
+ * Reads check the tag, then decrypt the slot headers and only the payload bytes in use: dummy slots and padding
+ * are never decrypted. The storage below is given a slightly larger block size to make room for the nonce and
+ * the tag, and ReadBlocks reads whole buckets, since a slot cannot be checked without its bucket.
+ */
+class EncryptedStorage : public UntrustedStorageInterface {
+private:
+    UntrustedStorageInterface* const storage;
+
+    const SM4Cipher cipher;
+
+    /**
+     * @brief Bound into every tag, e.g. the name of the ORAM, so that buckets cannot be moved between trees.
+     */
+    const std::string context;
+
+    int num_levels;
+
+    int slots_per_bucket;
+
+    int block_size;
+
+    /**
+     * @brief The block size of the storage below, which holds the sealed buckets.
+     */
+    int sealed_block_size;
+
+    size_t bucket_bytes;
+
+    size_t sealed_bytes;
+
+    std::vector<int> path_positions(const int& leaf, const int& start_level);
+
+    void compute_tag(const int& position, const unsigned char* ciphertext, const unsigned char* key, unsigned char* tag);
+
+    std::vector<Bucket> seal(const std::vector<int>& positions, const std::vector<Bucket>& buckets);
+
+    /**
+     * @brief Check and decrypt the buckets read from the given positions.
+     * @param slots if not null, only this slot of each bucket is decrypted; the others are left zeroed.
+     * @throw std::runtime_error if a bucket fails authentication.
+     */
+    std::vector<Bucket> open(
+        const std::vector<int>& positions, const std::vector<Bucket>& sealed, const std::vector<int>* slots = nullptr);
+
+public:
+    /**
+     * @brief The constructor for the EncryptedStorage class.
+     *
+     * @param storage The storage holding the sealed buckets, owned by this object.
+     * @param raw_key The SM4 key of the buckets.
+     * @param context Distinguishes this tree from the others sealed under the same key.
+     */
+    EncryptedStorage(UntrustedStorageInterface* storage, const std::string& raw_key, const std::string& context);
+
+    ~EncryptedStorage();
+
+    void setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size);
+
+    Bucket ReadBucket(const int& position);
+
+    void WriteBucket(const int& position, const Bucket& bucket_to_write);
+
+    std::vector<Bucket> ReadPath(const int& leaf, const int& start_level = 0);
+
+    void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0);
+
+    std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0);
+
+    std::vector<Bucket> ReadBuckets(const std::vector<int>& positions);
+
+    std::future<std::vector<Bucket>> ReadBucketsAsync(const std::vector<int>& positions);
+
+    void WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    void LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write);
+
+    void flush();
+
+    bool is_vectored();
+
+    void add_read(VectoredMessage& message, const std::vector<int>& positions);
+
+    std::vector<Bucket> take_read(BucketsReadResponse& response, const std::vector<int>& positions);
+
+    void add_write(VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+};
+
+#endif //PORAM_ENCRYPTEDSTORAGE_H
@@ -22,6 +22,7 @@
 #include <string>
 
 #include "Block.h"
+#include "Bucket.h"
 
 class OramInterface {
 public:
@@ -30,10 +31,68 @@ public:
         WRITE
     };
 
+    struct BatchOperation {
+        Operation op;
+
+        unsigned int block_index;
+
+        /**
+         * @brief The data to be written; ignored for a read.
+         */
+        std::string data;
+    };
+
     virtual std::string access(Operation op, const unsigned int& blockIndex, const std::string& newdata) { return 0; };
 
     virtual std::string access_direct(Operation op, const std::string& newdata) { return 0; }
 
+    /**
+     * @brief Perform several accesses at once.
+     *
+     * Engines that support it read the union of the paths once and evict them in a single write.
+     * The default is one access after another.
+     *
+     * @return the data read by each operation, in order (empty for a write).
+     */
+    virtual std::vector<std::string> access_batch(const std::vector<BatchOperation>& ops)
+    {
+        std::vector<std::string> results;
+        for (const BatchOperation& op : ops) {
+            results.push_back(access(op.op, op.block_index, op.data));
+        }
+        return results;
+    };
+
+    /**
+     * @brief Check a batch before anything of it is done, so that a bad operation cannot leave the ORAM half-way.
+     *
+     * @throw std::runtime_error if an operation is out of range or writes a block of the wrong size.
+     */
+    virtual void check_batch(const std::vector<BatchOperation>& ops) {};
+
+    /**
+     * @brief The first phase of access_batch, so that the bucket I/O of several ORAMs can be issued together.
+     *
+     * The blocks are remapped and the buckets that the batch has to read are returned. The default reads nothing
+     * and leaves all the work, I/O included, to finish_batch.
+     *
+     * @return the positions of the buckets to read, which finish_batch expects in this order.
+     */
+    virtual std::vector<int> begin_batch(const std::vector<BatchOperation>& ops) { return std::vector<int>(); };
+
+    /**
+     * @brief The second phase of access_batch, which follows begin_batch with the same operations.
+     *
+     * @param buckets the buckets read from the positions that begin_batch returned; they are consumed.
+     * @param evicted the buckets to write back to the same positions.
+     * @return the data read by each operation, in order (empty for a write).
+     */
+    virtual std::vector<std::string> finish_batch(
+        const std::vector<BatchOperation>& ops, std::vector<Bucket>& buckets, std::vector<Bucket>& evicted)
+    {
+        return access_batch(ops);
+    };
+
     virtual int P(int leaf, int level) { return 0; };
 
     virtual int* getPositionMap() { return 0; };
@@ -49,6 +108,8 @@ public:
     virtual int getNumBlocks() { return 0; };
 
     virtual int getNumBuckets() { return 0; };
+
+    virtual ~OramInterface() {};
 };
 
 #endif //PORAM_ORAMINTERFACE_H
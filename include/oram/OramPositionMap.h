@@ -0,0 +1,120 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_ORAMPOSITIONMAP_H
+#define PORAM_ORAMPOSITIONMAP_H
+
+#include <functional>
+#include <string>
+
+#include "OramReadPathEviction.h"
+#include "PositionMapInterface.h"
+#include "RandForOramInterface.h"
+#include "UntrustedStorageInterface.h"
+
+/**
+ * @brief A position map stored in a smaller Path ORAM on the server (recursive ORAM).
+ *
+ * The leaves of entries_per_block consecutive blocks are packed into one block of the inner ORAM, whose own
+ * position map is again an OramPositionMap until it has at most threshold blocks; the last level is kept on
+ * the client. Entries are created lazily: a block that has never been mapped is reported on a random leaf,
+ * which is where an ArrayPositionMap would have put it anyway.
+ */
+class OramPositionMap : public PositionMapInterface {
+public:
+    /**
+     * @brief Creates the storage of the inner ORAM of one level, given its name, e.g. a ServerStorage on the server.
+     */
+    typedef std::function<UntrustedStorageInterface*(const std::string& name)> StorageFactory;
+
+private:
+    const unsigned int num_blocks;
+
+    const unsigned int entries_per_block;
+
+    const unsigned int bucket_size;
+
+    const unsigned int threshold;
+
+    const std::string key;
+
+    const StorageFactory create_storage;
+
+    const unsigned int depth;
+
+    /**
+     * @brief Samples the leaves of the outer ORAM for unmapped blocks.
+     */
+    RandForOramInterface* rand_gen;
+
+    RandForOramInterface* inner_rand_gen;
+
+    UntrustedStorageInterface* storage;
+
+    OramReadPathEviction* oram;
+
+    void check_bound(const unsigned int& block_index);
+
+    /**
+     * @brief Build the inner ORAM, together with its own position map, from a set of packed blocks.
+     *
+     * Called by load() or, if the map has not been loaded, by the first access; never by the constructor.
+     */
+    void build(const std::vector<std::pair<unsigned int, std::string>>& blocks);
+
+    /**
+     * @brief Read the leaf of a block and, if leaf is not null, replace it within the same access.
+     */
+    unsigned int access_entry(const unsigned int& block_index, const unsigned int* leaf);
+
+public:
+    /**
+     * @brief The constructor for the OramPositionMap class.
+     *
+     * @param num_blocks The number of blocks in the outer ORAM.
+     * @param rand_gen The random engine of the outer ORAM.
+     * @param bucket_size The bucket size of the inner ORAMs.
+     * @param threshold The recursion stops once an inner ORAM has at most threshold blocks.
+     * @param key A key unique to the outer ORAM, used to name the inner ORAMs.
+     * @param create_storage Creates the storage of every inner ORAM, which the map owns. It should seal the
+     *                       buckets if those of the outer ORAM are, so that the server cannot read the leaves.
+     * @param entries_per_block The number of leaves packed into one block of the inner ORAM.
+     * @param depth The depth of this map in the recursion.
+     */
+    OramPositionMap(
+        const unsigned int& num_blocks, RandForOramInterface* rand_gen,
+        const unsigned int& bucket_size, const unsigned int& threshold,
+        const std::string& key, const StorageFactory& create_storage,
+        const unsigned int& entries_per_block = 32, const unsigned int& depth = 0);
+
+    ~OramPositionMap();
+
+    unsigned int get(const unsigned int& block_index);
+
+    void set(const unsigned int& block_index, const unsigned int& leaf);
+
+    unsigned int exchange(const unsigned int& block_index, const unsigned int& leaf);
+
+    /**
+     * @brief Pack the leaves into blocks locally and bulk-load a new inner ORAM with them.
+     */
+    void load(const std::vector<std::pair<unsigned int, unsigned int>>& leaves);
+
+    unsigned int size();
+};
+
+#endif //PORAM_ORAMPOSITIONMAP_H
@@ -19,18 +19,46 @@
 #define PORAM_ORAMREADPATHEVICTION_H
 
 #include <cmath>
-#include <map>
+#include <functional>
+#include <unordered_map>
 
 #include "OramInterface.h"
+#include "PositionMapInterface.h"
 #include "RandForOramInterface.h"
+#include "Stash.h"
 #include "UntrustedStorageInterface.h"
 
 class OramReadPathEviction : public OramInterface {
 private:
+    /**
+     * @brief Reject data that does not fit in a slot before the access changes any state.
+     */
+    void check_data_size(const std::string& data);
+
     std::string access_handler(
         Operation op, const unsigned int& blockIndex,
         const int& oldLeaf, const int& newLeaf, const std::string& newdata);
 
+    /**
+     * @brief Move every real block on the path to the stash.
+     */
+    void read_path(const int& leaf);
+
+    /**
+     * @brief Evict the stash onto the path and write it back.
+     */
+    void write_path(const int& leaf);
+
+    /**
+     * @brief The new leaf of every block of the batch between begin_batch and finish_batch.
+     */
+    std::unordered_map<unsigned int, int> batch_leaves;
+
+    /**
+     * @brief The buckets of the batch between begin_batch and finish_batch, sorted.
+     */
+    std::vector<int> batch_positions;
+
 public:
     UntrustedStorageInterface* storage;
 
@@ -38,6 +66,11 @@ public:
 
     unsigned int bucket_size;
 
+    /**
+     * @brief The size of the payload of a slot, i.e. the largest data a block may hold.
+     */
+    unsigned int block_size;
+
     unsigned int num_levels;
 
     unsigned int num_leaves;
@@ -46,19 +79,58 @@ public:
 
     unsigned int num_buckets;
 
-    std::map<unsigned int, unsigned int> position_map; //array
+    PositionMapInterface* position_map;
 
-    std::vector<Block> stash;
+    Stash stash;
 
+    /**
+     * @brief The constructor of the OramReadPathEviction class.
+     *
+     * @param position_map the position map, owned by the ORAM. A client-side ArrayPositionMap is used if it is null.
+     */
+    OramReadPathEviction(
+        UntrustedStorageInterface* storage,
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const unsigned int& block_size = BLOCK_SIZE,
+        PositionMapInterface* position_map = nullptr);
+
+    /**
+     * @brief Build the ORAM from a known dataset instead of writing every block with an access.
+     *
+     * Every block is mapped to a random leaf and packed into the deepest bucket on its path with a free slot;
+     * blocks that do not fit stay in the stash. The whole tree is then sent in one LoadBuckets call.
+     *
+     * @param blocks pairs of block index and data, with distinct indices.
+     */
     OramReadPathEviction(
         UntrustedStorageInterface* storage,
-        RandForOramInterface* rand_gen, const unsigned int& bucket_size, 
-        const unsigned int& num_blocks, const unsigned int& block_size = BLOCK_SIZE);
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+        const unsigned int& block_size = BLOCK_SIZE, PositionMapInterface* position_map = nullptr);
+
+    ~OramReadPathEviction();
 
     std::string access(Operation op, const unsigned int& blockIndex, const std::string& new_data);
 
     std::string access_direct(Operation op, const std::string& new_data);
 
+    std::vector<std::string> access_batch(const std::vector<BatchOperation>& ops);
+
+    void check_batch(const std::vector<BatchOperation>& ops);
+
+    std::vector<int> begin_batch(const std::vector<BatchOperation>& ops);
+
+    std::vector<std::string> finish_batch(
+        const std::vector<BatchOperation>& ops, std::vector<Bucket>& buckets, std::vector<Bucket>& evicted);
+
+    /**
+     * @brief Read a block and rewrite it within the same path access.
+     *
+     * @param update called on the data of the block, which is empty if the block has never been written.
+     * @return the data of the block before the update.
+     */
+    std::string access_update(const unsigned int& blockIndex, const std::function<void(std::string&)>& update);
+
     int P(int leaf, int level);
 
     int* getPositionMap();
@@ -25,4 +25,10 @@ typedef enum {
     ORAM_ACCESS_INSERT // insert to cache.
 } OramAccessOp;
 
+typedef enum {
+    ORAM_TYPE_PATH, // Path ORAM with read-path eviction.
+    ORAM_TYPE_RING, // Ring ORAM.
+    ORAM_TYPE_CIRCUIT // Circuit ORAM, for a small client stash.
+} OramType;
+
 #endif //PATHORAM_PATHORAM_H
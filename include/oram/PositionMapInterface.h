@@ -0,0 +1,68 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_POSITIONMAPINTERFACE_H
+#define PORAM_POSITIONMAPINTERFACE_H
+
+#include <utility>
+#include <vector>
+
+/**
+ * @brief This is a public interface for the position map (block index -> leaf) of any tree-based ORAM.
+ */
+class PositionMapInterface {
+public:
+    /**
+     * @brief Get the leaf to which the block is currently mapped.
+     * @param block_index
+     */
+    virtual unsigned int get(const unsigned int& block_index) { return 0; };
+
+    /**
+     * @brief Map the block to a new leaf.
+     * @param block_index
+     * @param leaf
+     */
+    virtual void set(const unsigned int& block_index, const unsigned int& leaf) {};
+
+    /**
+     * @brief Map the block to a new leaf and return the old one in a single operation.
+     * @param block_index
+     * @param leaf
+     */
+    virtual unsigned int exchange(const unsigned int& block_index, const unsigned int& leaf) { return 0; };
+
+    /**
+     * @brief Map many blocks at once when the ORAM is bulk-loaded.
+     * @param leaves pairs of block index and leaf.
+     */
+    virtual void load(const std::vector<std::pair<unsigned int, unsigned int>>& leaves)
+    {
+        for (const auto& entry : leaves) {
+            set(entry.first, entry.second);
+        }
+    };
+
+    /**
+     * @brief The number of blocks covered by the position map.
+     */
+    virtual unsigned int size() { return 0; };
+
+    virtual ~PositionMapInterface() {};
+};
+
+#endif //PORAM_POSITIONMAPINTERFACE_H
@@ -23,6 +23,8 @@ public:
     virtual int getRandomLeaf() { return 0; };
 
     virtual void setBound(int num_leaves) {};
+
+    virtual ~RandForOramInterface() {};
 };
 
 #endif
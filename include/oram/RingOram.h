@@ -0,0 +1,179 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_RINGORAM_H
+#define PORAM_RINGORAM_H
+
+#include <cmath>
+#include <vector>
+
+#include "OramInterface.h"
+#include "PositionMapInterface.h"
+#include "RandForOramInterface.h"
+#include "Stash.h"
+#include "UntrustedStorageInterface.h"
+
+#include <csprng.hpp>
+
+/**
+ * @brief Ring ORAM (Ren et al., USENIX Security'15).
+ *
+ * Every bucket holds Z real and S dummy slots in a random order. An access reads only one slot
+ * per bucket on the path: the requested block if the bucket holds it, otherwise a fresh dummy.
+ * Every A accesses a path chosen in reverse lexicographic order is evicted, and a bucket that has
+ * been read S times is reshuffled early.
+ *
+ * @note The bucket metadata (slot addresses, valid bits and read counters) is kept on the client.
+ */
+class RingOram : public OramInterface {
+private:
+    /**
+     * @brief Reject data that does not fit in a slot before the access changes any state.
+     */
+    void check_data_size(const std::string& data);
+
+    struct BucketMetadata {
+        /**
+         * @brief The block index held by each slot, -1 for a dummy.
+         */
+        std::vector<int> addresses;
+
+        /**
+         * @brief Whether a slot has not yet been read since the last reshuffle.
+         */
+        std::vector<bool> valid;
+
+        /**
+         * @brief The number of reads since the last reshuffle.
+         */
+        unsigned int count;
+    };
+
+    std::string access_handler(
+        Operation op, const unsigned int& blockIndex,
+        const int& oldLeaf, const int& newLeaf, const std::string& newdata);
+
+    /**
+     * @brief Read one slot per bucket on the path and move the requested block (if any) to the stash.
+     */
+    void read_path(const int& leaf, const unsigned int& blockIndex);
+
+    /**
+     * @brief Evict the stash onto the next path in reverse lexicographic order.
+     */
+    void evict_path();
+
+    /**
+     * @brief Reshuffle the buckets on the path that have run out of dummy slots.
+     */
+    void early_reshuffle(const int& leaf);
+
+    /**
+     * @brief Pad the blocks with dummies to Z + S slots, permute them and reset the metadata.
+     */
+    Bucket permute_bucket(std::vector<Block>&& blocks, BucketMetadata& meta);
+
+    unsigned int random_below(const unsigned int& bound);
+
+public:
+    UntrustedStorageInterface* storage;
+
+    RandForOramInterface* rand_gen;
+
+    unsigned int bucket_size;
+
+    /**
+     * @brief The size of the payload of a slot, i.e. the largest data a block may hold.
+     */
+    unsigned int block_size;
+
+    unsigned int dummy_size;
+
+    unsigned int eviction_rate;
+
+    unsigned int num_levels;
+
+    unsigned int num_leaves;
+
+    unsigned int num_blocks;
+
+    unsigned int num_buckets;
+
+    unsigned int round;
+
+    unsigned int eviction_counter;
+
+    PositionMapInterface* position_map;
+
+    Stash stash;
+
+    std::vector<BucketMetadata> metadata;
+
+    duthomhas::csprng rng;
+
+    /**
+     * @brief The constructor of the RingOram class.
+     *
+     * @param bucket_size the number of real slots in a bucket (Z).
+     * @param position_map the position map, owned by the ORAM. A client-side ArrayPositionMap is used if it is null.
+     * @param dummy_size the number of dummy slots in a bucket (S).
+     * @param eviction_rate a path is evicted every eviction_rate accesses (A).
+     */
+    RingOram(
+        UntrustedStorageInterface* storage,
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const unsigned int& block_size = BLOCK_SIZE,
+        PositionMapInterface* position_map = nullptr,
+        const unsigned int& dummy_size = 6, const unsigned int& eviction_rate = 3);
+
+    /**
+     * @brief Build the ORAM from a known dataset instead of writing every block with an access.
+     *
+     * @param blocks pairs of block index and data, with distinct indices.
+     * @see OramReadPathEviction
+     */
+    RingOram(
+        UntrustedStorageInterface* storage,
+        RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+        const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+        const unsigned int& block_size = BLOCK_SIZE, PositionMapInterface* position_map = nullptr,
+        const unsigned int& dummy_size = 6, const unsigned int& eviction_rate = 3);
+
+    ~RingOram();
+
+    std::string access(Operation op, const unsigned int& blockIndex, const std::string& new_data);
+
+    std::string access_direct(Operation op, const std::string& new_data);
+
+    int P(int leaf, int level);
+
+    int* getPositionMap();
+
+    vector<Block> getStash();
+
+    int getStashSize();
+
+    int getNumLeaves();
+
+    int getNumLevels();
+
+    int getNumBlocks();
+
+    int getNumBuckets();
+};
+
+#endif
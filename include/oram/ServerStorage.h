@@ -19,14 +19,23 @@
 #define PORAM_SERVERSTORAGE_H
 
 #include <cmath>
+#include <list>
+#include <memory>
+#include <unordered_map>
 
 #include "OramInterface.h"
 #include "RandForOramInterface.h"
 #include "UntrustedStorageInterface.h"
 
+#include <grpc++/completion_queue.h>
 #include <proto/seal.grpc.pb.h>
 #include <proto/seal.pb.h>
 
+/**
+ * @brief The size in bytes of a chunk of a streamed tree, well below the default gRPC message limit.
+ */
+#define LOAD_CHUNK_SIZE (1 << 20)
+
 /**
  * This design is shit, bullshit.
  * 
@@ -45,6 +54,21 @@
  */
 class ServerStorage : public UntrustedStorageInterface {
 private:
+    /**
+     * @brief A path write that has been sent to the server but not yet acknowledged.
+     */
+    struct PendingWrite {
+        grpc::ClientContext context;
+
+        google::protobuf::Empty reply;
+
+        grpc::Status status;
+
+        std::unique_ptr<grpc::ClientAsyncResponseReader<google::protobuf::Empty>> reader;
+
+        std::vector<int> positions;
+    };
+
     Seal::Stub* const stub_;
 
     const unsigned int oram_id;
@@ -53,6 +77,36 @@ private:
 
     const std::string key;
 
+    /**
+     * @brief The handle returned by set_capacity, which identifies the storage in every other request.
+     */
+    uint64_t handle;
+
+    const bool async_write;
+
+    grpc::CompletionQueue cq;
+
+    std::list<PendingWrite> pending_writes;
+
+    /**
+     * @brief The buckets of the pending writes by position; reads are served from here until the write is acknowledged.
+     */
+    std::unordered_map<int, Bucket> pending_buckets;
+
+    /**
+     * @brief Send the bucket operations over one stream instead of a call per operation.
+     */
+    const bool use_session;
+
+    std::unique_ptr<grpc::ClientContext> session_context;
+
+    std::unique_ptr<grpc::ClientReaderWriter<SessionRequest, SessionResponse>> session;
+
+    /**
+     * @brief The number of requests sent on the session whose responses have not been read yet.
+     */
+    size_t unanswered;
+
 public:
 
     /**
@@ -60,19 +114,109 @@ public:
      * 
      * @param oram_id The id of the oram structure to which it belongs.
      * @param is_odict Oblivioud data structure is a little bit different.
-     * @param key Used to look up the storage on the server side.
+     * @param key Used to register the storage on the server side, which hands back a handle for it.
      * @param stub_ Connection to the server.
+     * @param async_write Send path writes without waiting for the server, so that the eviction overlaps with the next access.
+     * @param use_session Send the bucket operations over one ORAM session. The server answers them in order, so writes
+     *                    are never waited for, and their errors are reported by the next read or flush.
      */
-    ServerStorage(const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub * stub_);
+    ServerStorage(
+        const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub * stub_,
+        const bool& async_write = false, const bool& use_session = false);
 
-    void setCapacity(const int& total_number_of_buckets);
+    ~ServerStorage();
+
+    void setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size);
 
     Bucket ReadBucket(const int& position);
 
     void WriteBucket(const int& position, const Bucket& bucket_to_write);
 
+    std::vector<Bucket> ReadPath(const int& leaf, const int& start_level = 0);
+
+    void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0);
+
+    std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0);
+
+    std::vector<Bucket> ReadBuckets(const std::vector<int>& positions);
+
+    void WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    void LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write);
+
+    void flush();
+
+    /**
+     * @brief Get the handle of the storage on the server, which is valid once the capacity is set.
+     */
+    uint64_t get_handle() const;
+
+    bool is_vectored();
+
+    void add_read(VectoredMessage& message, const std::vector<int>& positions);
+
+    std::vector<Bucket> take_read(BucketsReadResponse& response, const std::vector<int>& positions);
+
+    void add_write(VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
 private:
     int capacity;
+
+    int num_levels;
+
+    int block_size;
+
+    void check_position(const int& position);
+
+    void check_path(const int& leaf, const int& start_level);
+
+    /**
+     * @brief Handle one acknowledged write.
+     *
+     * @param wait Block until a write is acknowledged instead of returning when none is ready.
+     * @return whether a write was handled.
+     */
+    bool complete_write(const bool& wait);
+
+    /**
+     * @brief Register an asynchronous write of the buckets, once no earlier write to them is in flight.
+     * @return the pending write, on which the caller starts the RPC.
+     */
+    PendingWrite& begin_write(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    /**
+     * @brief Block until none of the buckets is being written.
+     */
+    void wait_for(const std::vector<int>& positions);
+
+    /**
+     * @brief Get the number of levels from start_level on that can be served from the pending writes.
+     *
+     * Every write covers a path, so the pending buckets on another path form a prefix of it. If they do not,
+     * the pending writes are flushed and the whole path is read from the server.
+     */
+    int pending_prefix(const int& leaf, const int& start_level);
+
+    /**
+     * @brief Send a request on the session, which is opened on first use. Its response is read by a later call or flush.
+     */
+    void post(const SessionRequest& request);
+
+    /**
+     * @brief Send a request on the session and wait for its response, after the responses to the requests before it.
+     */
+    SessionResponse call(const SessionRequest& request);
+
+    /**
+     * @brief Read the response to the oldest unanswered request and throw if it failed.
+     */
+    void receive(SessionResponse& response);
+
+    /**
+     * @brief Close the session, discarding the responses that have not been read.
+     * @return the status with which the server ended the session.
+     */
+    grpc::Status close_session();
 };
 
 #endif //PORAM_ORAMREADPATHEVICTION_H
@@ -0,0 +1,106 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_STASH_H
+#define PORAM_STASH_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "Block.h"
+#include "Bucket.h"
+
+/**
+ * @brief The client-side stash of a tree-based ORAM.
+ *
+ * Blocks are kept in a dense array and indexed by their block index, so a lookup is O(1) and
+ * an eviction onto a path costs O(stash + Z * L) without copying any block.
+ */
+class Stash {
+private:
+    std::vector<Block> blocks;
+
+    /**
+     * @brief Maps a block index to its slot in the blocks array.
+     */
+    std::unordered_map<int, size_t> slots;
+
+    /**
+     * @brief Drop the evicted blocks, keep the others dense and rebuild the index.
+     */
+    void compact(const std::vector<bool>& evicted);
+
+public:
+    /**
+     * @brief Find a block by its index.
+     * @return nullptr if the block is not in the stash.
+     */
+    Block* find(const int& block_index);
+
+    /**
+     * @brief Add a block to the stash, replacing any block with the same index.
+     */
+    void add(Block&& block);
+
+    /**
+     * @brief Remove a block from the stash.
+     * @return whether the block was found.
+     */
+    bool remove(const int& block_index);
+
+    /**
+     * @brief Move as many blocks as possible onto the path to the leaf, deepest level first.
+     *
+     * Every block is filed under the deepest level it shares with the path, and each bucket is then
+     * filled from the blocks filed at its level or below. Buckets are padded with dummy blocks.
+     *
+     * @param leaf the path being written back.
+     * @param num_levels the height of the tree.
+     * @param bucket_size the number of blocks in a bucket (Z).
+     * @param block_size the size of the payload of a slot.
+     * @return the buckets ordered from the root to the leaf.
+     *
+     * @note Blocks are placed according to their leaf_id, which the engine keeps in sync with its position map.
+     * @throw std::out_of_range if the leaf or the leaf of any block is not in the tree; the stash is left as is.
+     */
+    std::vector<Bucket> evict(
+        const int& leaf, const unsigned int& num_levels, const unsigned int& bucket_size, const unsigned int& block_size);
+
+    /**
+     * @brief Move as many blocks as possible onto the union of several paths, deepest bucket first.
+     *
+     * Every block is filed under the deepest bucket it can reach in the union, and blocks that do not fit
+     * are passed on to the parent bucket. Buckets are padded with dummy blocks.
+     *
+     * @param positions the buckets of the union, in ascending order.
+     * @return the buckets in the same order as the positions.
+     */
+    std::vector<Bucket> evict_buckets(
+        const std::vector<int>& positions, const unsigned int& num_levels, const unsigned int& bucket_size,
+        const unsigned int& block_size);
+
+    const std::vector<Block>& get_blocks();
+
+    size_t size();
+
+    /**
+     * @brief Get the deepest level at which the paths to two leaves still share a bucket.
+     */
+    static int common_level(const int& lhs, const int& rhs, const unsigned int& num_levels);
+};
+
+#endif //PORAM_STASH_H
@@ -0,0 +1,110 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PORAM_TREETOPCACHESTORAGE_H
+#define PORAM_TREETOPCACHESTORAGE_H
+
+#include <future>
+#include <vector>
+
+#include "UntrustedStorageInterface.h"
+
+/**
+ * @brief Keeps the top levels of the ORAM tree in client memory and forwards the rest to another storage.
+ *
+ * The top levels are on every path, so caching k of them saves k buckets per path read and write.
+ * A path only goes to the underlying storage for the levels from k down, through the start_level of the
+ * path interface. The cache takes (2^k - 1) * Z blocks of client memory.
+ */
+class TreeTopCacheStorage : public UntrustedStorageInterface {
+private:
+    UntrustedStorageInterface* const storage;
+
+    /**
+     * @brief The number of levels requested, which may exceed the height of the tree.
+     */
+    const int max_cached_levels;
+
+    int cached_levels;
+
+    int num_levels;
+
+    /**
+     * @brief The cached buckets, in the same heap order as the storage (a prefix of it).
+     */
+    std::vector<Bucket> top;
+
+    bool is_cached(const int& position);
+
+    /**
+     * @brief Get the positions that are not cached, in the same order.
+     */
+    std::vector<int> remote_positions(const std::vector<int>& positions);
+
+    /**
+     * @brief Interleave the cached buckets with those read from the storage below for the other positions.
+     */
+    std::vector<Bucket> merge_remote(const std::vector<int>& positions, std::vector<Bucket>&& remote);
+
+    /**
+     * @brief Update the cached buckets and return the others, in the same order as remote_positions.
+     */
+    std::vector<Bucket> write_cached(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+public:
+    /**
+     * @brief The constructor for the TreeTopCacheStorage class.
+     *
+     * @param storage The storage holding the rest of the tree, owned by this object.
+     * @param cached_levels The number of levels kept on the client.
+     */
+    TreeTopCacheStorage(UntrustedStorageInterface* storage, const int& cached_levels);
+
+    ~TreeTopCacheStorage();
+
+    void setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size);
+
+    Bucket ReadBucket(const int& position);
+
+    void WriteBucket(const int& position, const Bucket& bucket_to_write);
+
+    std::vector<Bucket> ReadPath(const int& leaf, const int& start_level = 0);
+
+    void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0);
+
+    std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0);
+
+    std::vector<Bucket> ReadBuckets(const std::vector<int>& positions);
+
+    std::future<std::vector<Bucket>> ReadBucketsAsync(const std::vector<int>& positions);
+
+    void WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+
+    void LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write);
+
+    void flush();
+
+    bool is_vectored();
+
+    void add_read(VectoredMessage& message, const std::vector<int>& positions);
+
+    std::vector<Bucket> take_read(BucketsReadResponse& response, const std::vector<int>& positions);
+
+    void add_write(VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write);
+};
+
+#endif //PORAM_TREETOPCACHESTORAGE_H
@@ -18,18 +18,27 @@
 #ifndef PORAM_UNTRUSTEDSTORAGEINTERFACE_H
 #define PORAM_UNTRUSTEDSTORAGEINTERFACE_H
 
+#include <future>
+#include <stdexcept>
+#include <vector>
+
 #include "Bucket.h"
 
+class VectoredMessage;
+class BucketsReadResponse;
+
 /**
  * @brief This is a public interface for any inheritance of server storage.
  */
 class UntrustedStorageInterface {
 public:
     /**
-     * @brief Set the capacity of buckets.
+     * @brief Set the capacity of buckets and their fixed geometry.
      * @param total_num_of_buckets
+     * @param slots_per_bucket the number of slots in every bucket.
+     * @param block_size the size of the payload of a slot. @see SlotHeader
      */ 
-    virtual void setCapacity(const int& total_num_of_buckets) {};
+    virtual void setCapacity(const int& total_num_of_buckets, const int& slots_per_bucket, const int& block_size) {};
 
     /**
      * @brief Write to the bucket, called by the oram implementation.
@@ -43,6 +52,118 @@ public:
      * @param position
      */ 
     virtual Bucket ReadBucket(const int& position) { return Bucket(); };
+
+    /**
+     * @brief Read all the buckets on the path to the leaf in one round trip.
+     * @param leaf
+     * @param start_level the first level to be read; the levels above it are skipped.
+     * @return the buckets ordered from the root to the leaf.
+     */
+    virtual std::vector<Bucket> ReadPath(const int& leaf, const int& start_level = 0) { return std::vector<Bucket>(); };
+
+    /**
+     * @brief Write all the buckets on the path to the leaf in one round trip.
+     * @param leaf
+     * @param buckets_to_write ordered from the root to the leaf.
+     * @param start_level the level of the first bucket to be written.
+     */
+    virtual void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level = 0) {};
+
+    /**
+     * @brief Read exactly one block from every bucket on the path to the leaf.
+     * @param leaf
+     * @param offsets the slot to be read in each bucket, ordered from the root to the leaf.
+     * @param start_level the level of the first bucket to be read.
+     * @return the blocks ordered from the root to the leaf.
+     */
+    virtual std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level = 0) { return std::vector<Block>(); };
+
+    /**
+     * @brief Read a set of buckets (e.g. the union of several paths) in one round trip.
+     * @param positions
+     * @return the buckets in the same order as the positions.
+     */
+    virtual std::vector<Bucket> ReadBuckets(const std::vector<int>& positions)
+    {
+        std::vector<Bucket> buckets;
+        for (const int& position : positions) {
+            buckets.push_back(ReadBucket(position));
+        }
+        return buckets;
+    };
+
+    /**
+     * @brief Start reading a set of buckets, so that the reads of several storages overlap.
+     * @param positions
+     * @return the buckets in the same order as the positions. A storage without requests in flight of its own reads
+     *         them when they are waited for.
+     */
+    virtual std::future<std::vector<Bucket>> ReadBucketsAsync(const std::vector<int>& positions)
+    {
+        return std::async(std::launch::deferred, [this, positions] { return ReadBuckets(positions); });
+    };
+
+    /**
+     * @brief Write a set of buckets in one round trip.
+     * @param positions
+     * @param buckets_to_write in the same order as the positions.
+     */
+    virtual void WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+    {
+        for (size_t i = 0; i < positions.size() && i < buckets_to_write.size(); i++) {
+            WriteBucket(positions[i], buckets_to_write[i]);
+        }
+    };
+
+    /**
+     * @brief Write a contiguous range of buckets when the tree is built, e.g. the whole tree in heap order.
+     * @param first_position the position of the first bucket.
+     * @param buckets_to_write
+     */
+    virtual void LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write)
+    {
+        for (size_t i = 0; i < buckets_to_write.size(); i++) {
+            WriteBucket(first_position + i, buckets_to_write[i]);
+        }
+    };
+
+    /**
+     * @brief Block until every write issued so far has reached the storage.
+     */
+    virtual void flush() {};
+
+    /**
+     * @brief Whether the buckets can be moved by a vectored request, which reads or writes the buckets of several
+     *        storages on the server in one round trip. A storage that wraps another one is if the storage below is.
+     */
+    virtual bool is_vectored() { return false; };
+
+    /**
+     * @brief Add a read of the buckets to a vectored request. Only for a storage that is_vectored.
+     */
+    virtual void add_read(VectoredMessage& message, const std::vector<int>& positions)
+    {
+        throw std::logic_error("The storage cannot be read by a vectored request.");
+    };
+
+    /**
+     * @brief Take the buckets of a read added by add_read out of its part of the response.
+     * @return the buckets in the same order as the positions.
+     */
+    virtual std::vector<Bucket> take_read(BucketsReadResponse& response, const std::vector<int>& positions)
+    {
+        throw std::logic_error("The storage cannot be read by a vectored request.");
+    };
+
+    /**
+     * @brief Add a write of the buckets to a vectored request. Only for a storage that is_vectored.
+     */
+    virtual void add_write(VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+    {
+        throw std::logic_error("The storage cannot be written by a vectored request.");
+    };
+
+    virtual ~UntrustedStorageInterface() {};
 };
 
 #endif //PORAM_UNTRUSTEDSTORAGEINTERFACE_H
@@ -0,0 +1,91 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_BUCKET_STORE_INTERFACE_H
+#define SEAL_BUCKET_STORE_INTERFACE_H
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief This is a public interface for the server-side storage of one ORAM tree.
+ *
+ * Buckets are opaque, fixed-size byte strings in the slot format (@see SlotHeader): the server never looks
+ * inside them, so a store only has to copy bytes in and out, e.g. straight into a protobuf bytes field.
+ */
+class BucketStoreInterface {
+public:
+    /**
+     * @brief The number of buckets.
+     */
+    virtual size_t size() const { return 0; };
+
+    /**
+     * @brief The number of slots in a bucket.
+     */
+    virtual size_t num_slots() const { return 0; };
+
+    /**
+     * @brief The size of the payload of a slot.
+     */
+    virtual size_t block_size() const { return 0; };
+
+    /**
+     * @brief The size of a bucket in bytes.
+     */
+    virtual size_t bucket_size() const { return 0; };
+
+    /**
+     * @brief The number of bytes of memory that the store holds on to.
+     */
+    virtual size_t memory_size() const { return 0; };
+
+    /**
+     * @brief The number of bytes that the store takes on disk.
+     */
+    virtual size_t disk_size() const { return 0; };
+
+    /**
+     * @brief Copy a bucket out of the store.
+     * @param position
+     * @param destination room for bucket_size() bytes.
+     * @throw std::out_of_range if there is no bucket at the position.
+     */
+    virtual void read(const size_t& position, char* destination) const {};
+
+    /**
+     * @brief Copy a single slot, header included, out of the store.
+     * @param destination room for the size of a slot.
+     * @throw std::out_of_range if there is no such bucket or slot.
+     */
+    virtual void read_slot(const size_t& position, const size_t& offset, char* destination) const {};
+
+    /**
+     * @throw std::out_of_range if there is no bucket at the position.
+     * @throw std::invalid_argument if the bucket does not have the size of a bucket of this store.
+     */
+    virtual void write(const size_t& position, std::string_view bucket) {};
+
+    /**
+     * @brief Make every write so far durable, if the store is backed by a disk.
+     */
+    virtual void sync() {};
+
+    virtual ~BucketStoreInterface() {};
+};
+
+#endif // SEAL_BUCKET_STORE_INTERFACE_H
@@ -0,0 +1,186 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_MAPPED_BUCKET_STORE_H
+#define SEAL_MAPPED_BUCKET_STORE_H
+
+#include "BucketStoreInterface.h"
+#include "StorageOptions.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The size of the header at the beginning of a tree file; the buckets start on the next page.
+ */
+#define TREE_HEADER_SIZE 4096
+
+/**
+ * @brief The alignment of the extent of a subtree, so that a subtree never straddles more pages than it fills.
+ */
+#define TREE_EXTENT_ALIGNMENT 4096
+
+/**
+ * @brief The header of a tree file.
+ *
+ * The label is stored right after it and identifies the owner of the tree when the file is reopened.
+ */
+struct TreeFileHeader {
+    char magic[8];
+
+    uint64_t num_buckets;
+
+    uint64_t slots_per_bucket;
+
+    uint64_t block_size;
+
+    uint64_t subtree_levels;
+
+    uint64_t label_size;
+};
+
+/**
+ * @brief Keeps the buckets of one ORAM tree in a preallocated file that is mapped into memory.
+ *
+ * The file is a header page followed by the buckets, so that a tree can be reopened without reading it, and
+ * only the pages in use need to be in memory when the tree is larger than RAM.
+ *
+ * The buckets are either in heap order, where a path touches a different page at every level, or packed by
+ * subtrees: the tree is cut into bands of subtree_levels levels, and every subtree of a band is stored in
+ * its own page-aligned extent, in heap order within it. A path then crosses only one extent per band.
+ */
+class MappedBucketStore : public BucketStoreInterface {
+private:
+    char* mapping;
+
+    size_t mapping_size;
+
+    /**
+     * @brief The size of the top of the tree that is locked in memory.
+     */
+    size_t pinned_size;
+
+    size_t num_buckets;
+
+    size_t slots_per_bucket;
+
+    size_t slot_size;
+
+    /**
+     * @brief The number of levels of a packed subtree, or 0 for heap order.
+     */
+    size_t subtree_levels;
+
+    /**
+     * @brief The offset of the first extent of every band, followed by the end of the buckets.
+     */
+    std::vector<size_t> band_offsets;
+
+    /**
+     * @brief The size of an extent of every band.
+     */
+    std::vector<size_t> extent_sizes;
+
+    std::string label;
+
+    const SyncPolicy sync_policy;
+
+    void map(const std::string& path, const int& flags);
+
+    /**
+     * @brief Write the header and fill the tree with dummies.
+     */
+    void initialize(const size_t& block_size);
+
+    void read_header(const std::string& path);
+
+    /**
+     * @brief Compute the extents of the subtrees.
+     * @return the size of the buckets in the file.
+     */
+    size_t plan_layout();
+
+    /**
+     * @brief Keep the levels of the tree above the given one in memory, rounded up to whole bands.
+     */
+    void pin_levels(const size_t& levels);
+
+    void check_position(const size_t& position) const;
+
+    char* bucket_at(const size_t& position) const;
+
+public:
+    /**
+     * @brief Create a tree file whose slots are all dummies, replacing the file at the path if there is one.
+     *
+     * The file is built under a temporary name and renamed at the end, so that a crash never leaves half a
+     * tree behind, and so that a store still mapping the old file keeps working.
+     *
+     * @param path
+     * @param num_buckets
+     * @param slots_per_bucket
+     * @param block_size the size of the payload of a slot.
+     * @param label Stored in the header to tell what the tree belongs to when it is reopened.
+     * @param sync_policy
+     * @param subtree_levels The number of levels of a packed subtree, or 0 to store the buckets in heap order.
+     * @param cached_levels The number of levels at the top of the tree that are locked in memory.
+     * @throw std::system_error if the file cannot be created.
+     */
+    MappedBucketStore(
+        const std::string& path, const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+        const std::string& label, const SyncPolicy& sync_policy = SYNC_NONE,
+        const size_t& subtree_levels = 0, const size_t& cached_levels = 0);
+
+    /**
+     * @brief Reopen an existing tree file, in the layout it was created with.
+     *
+     * @throw std::system_error if the file cannot be opened.
+     * @throw std::runtime_error if the file is not a tree file or has been truncated.
+     */
+    MappedBucketStore(const std::string& path, const SyncPolicy& sync_policy = SYNC_NONE, const size_t& cached_levels = 0);
+
+    MappedBucketStore(const MappedBucketStore&) = delete;
+
+    MappedBucketStore& operator=(const MappedBucketStore&) = delete;
+
+    ~MappedBucketStore();
+
+    const std::string& get_label() const;
+
+    size_t size() const;
+
+    size_t num_slots() const;
+
+    size_t block_size() const;
+
+    size_t bucket_size() const;
+
+    size_t memory_size() const;
+
+    size_t disk_size() const;
+
+    void read(const size_t& position, char* destination) const;
+
+    void read_slot(const size_t& position, const size_t& offset, char* destination) const;
+
+    void write(const size_t& position, std::string_view bucket);
+
+    void sync();
+};
+
+#endif // SEAL_MAPPED_BUCKET_STORE_H
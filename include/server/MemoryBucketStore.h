@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_MEMORY_BUCKET_STORE_H
+#define SEAL_MEMORY_BUCKET_STORE_H
+
+#include "BucketStoreInterface.h"
+
+#include <vector>
+
+/**
+ * @brief Keeps the buckets of one ORAM tree back to back in a contiguous arena in memory.
+ *
+ * The arena is mapped anonymously, so that it can be backed by huge pages: a tree of a few GiB then needs a
+ * few thousand TLB entries instead of a million. Explicit huge pages (MAP_HUGETLB) are tried first; if none
+ * are reserved, the kernel is asked to use transparent huge pages for the arena instead.
+ */
+class MemoryBucketStore : public BucketStoreInterface {
+private:
+    char* arena;
+
+    size_t arena_size;
+
+    const size_t num_buckets;
+
+    const size_t slots_per_bucket;
+
+    const size_t slot_size;
+
+    /**
+     * @brief The buckets written since the last snapshot.
+     */
+    std::vector<bool> dirty;
+
+    /**
+     * @brief Whether the store has been saved to a snapshot at all.
+     */
+    bool saved;
+
+    void check_position(const size_t& position) const;
+
+public:
+    /**
+     * @brief Create a store whose slots are all dummies.
+     *
+     * @param num_buckets
+     * @param slots_per_bucket
+     * @param block_size the size of the payload of a slot.
+     * @param huge_pages Back the arena with huge pages when the system provides them.
+     */
+    MemoryBucketStore(
+        const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+        const bool& huge_pages = false);
+
+    MemoryBucketStore(const MemoryBucketStore&) = delete;
+
+    MemoryBucketStore& operator=(const MemoryBucketStore&) = delete;
+
+    ~MemoryBucketStore();
+
+    /**
+     * @brief Get the size of the arena of a store, which is the memory it counts against the budget of the server.
+     *
+     * With huge pages, the arena is rounded up to a whole number of them.
+     */
+    static size_t mapping_size(
+        const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size, const bool& huge_pages);
+
+    size_t size() const;
+
+    size_t num_slots() const;
+
+    size_t block_size() const;
+
+    size_t bucket_size() const;
+
+    size_t memory_size() const;
+
+    size_t disk_size() const;
+
+    void read(const size_t& position, char* destination) const;
+
+    void read_slot(const size_t& position, const size_t& offset, char* destination) const;
+
+    void write(const size_t& position, std::string_view bucket);
+
+    /**
+     * @brief Get the buckets written since the last call, and start tracking afresh.
+     *
+     * @note Writes must be held off, but reads may go on meanwhile.
+     */
+    std::vector<size_t> take_dirty();
+
+    bool is_saved() const;
+
+    void set_saved(const bool& saved);
+};
+
+#endif // SEAL_MEMORY_BUCKET_STORE_H
@@ -0,0 +1,151 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_CALLBACK_SERVICE_H
+#define SEAL_CALLBACK_SERVICE_H
+
+#include <grpc++/server.h>
+#include <grpcpp/support/server_callback.h>
+
+#include <proto/seal.grpc.pb.h>
+#include <proto/seal.pb.h>
+#include <server/SealCore.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief The default number of workers that run the blocking handlers of the callback service.
+ */
+#define CALLBACK_WORKERS 8
+
+/**
+ * @brief The callback service, which runs the handlers without a thread for every call in flight.
+ *
+ * The bucket operations on trees in memory are short and run to completion inline, on the threads that poll
+ * for requests. Everything that may wait longer, i.e. the database behind setup, insert and select, filling a
+ * new tree, bulk loads and the bucket operations on trees in files, is handed to a fixed pool of workers, which
+ * finish the call from there. The streams keep one read or write pending at a time and handle every message as
+ * the synchronous service does. An exception escaping a handler fails its call with INTERNAL.
+ */
+class SealCallbackService : public Seal::CallbackService {
+private:
+    friend class LoadBucketsReactor;
+
+    friend class OramSessionReactor;
+
+    const std::shared_ptr<SealCore> core;
+
+    /**
+     * @brief Whether the bucket operations are handed to the workers too.
+     */
+    const bool defer_buckets;
+
+    std::mutex task_lock;
+
+    std::condition_variable task_ready;
+
+    std::deque<std::function<void()>> tasks;
+
+    bool stopping;
+
+    std::vector<std::thread> workers;
+
+    /**
+     * @brief Run the tasks until the service is destroyed and no task is left.
+     */
+    void run_tasks();
+
+    /**
+     * @brief Hand a task to the workers.
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * @brief Finish a unary call with the status of the handler.
+     */
+    grpc::ServerUnaryReactor* finish(grpc::CallbackServerContext* context, const grpc::Status& status);
+
+    /**
+     * @brief Run a handler on the workers, which finish the unary call with its status.
+     */
+    grpc::ServerUnaryReactor* defer(grpc::CallbackServerContext* context, std::function<grpc::Status()> handler);
+
+    /**
+     * @brief Run a bucket operation inline if the trees are in memory, and on the workers otherwise.
+     */
+    grpc::ServerUnaryReactor* serve_buckets(grpc::CallbackServerContext* context, std::function<grpc::Status()> handler);
+
+public:
+    /**
+     * @param workers The number of threads that run the blocking handlers.
+     */
+    SealCallbackService(const StorageOptions& options = StorageOptions(), const size_t& workers = CALLBACK_WORKERS);
+
+    /**
+     * @param core The state of the server, which may be shared with another service.
+     * @param workers The number of threads that run the blocking handlers.
+     */
+    SealCallbackService(const std::shared_ptr<SealCore>& core, const size_t& workers = CALLBACK_WORKERS);
+
+    /**
+     * @brief Run the tasks left, whose calls the server waits for on shutdown, and stop the workers.
+     */
+    ~SealCallbackService();
+
+    grpc::ServerUnaryReactor* setup(grpc::CallbackServerContext* context, const SetupMessage* request, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* set_capacity(grpc::CallbackServerContext* context, const BucketSetMessage* message, BucketSetResponse* response) override;
+
+    grpc::ServerUnaryReactor* read_bucket(grpc::CallbackServerContext* context, const BucketReadMessage* message, BucketReadResponse* reponse) override;
+
+    grpc::ServerUnaryReactor* write_bucket(grpc::CallbackServerContext* context, const BucketWriteMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* read_path(grpc::CallbackServerContext* context, const PathReadMessage* message, PathReadResponse* response) override;
+
+    grpc::ServerUnaryReactor* write_path(grpc::CallbackServerContext* context, const PathWriteMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* read_path_blocks(grpc::CallbackServerContext* context, const PathBlocksReadMessage* message, PathBlocksReadResponse* response) override;
+
+    grpc::ServerUnaryReactor* read_buckets(grpc::CallbackServerContext* context, const BucketsReadMessage* message, BucketsReadResponse* response) override;
+
+    grpc::ServerUnaryReactor* write_buckets(grpc::CallbackServerContext* context, const BucketsWriteMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* vectored_access(grpc::CallbackServerContext* context, const VectoredMessage* message, VectoredResponse* response) override;
+
+    grpc::ServerReadReactor<BucketsWriteMessage>* load_buckets(grpc::CallbackServerContext* context, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* storage_info(grpc::CallbackServerContext* context, const StorageInfoMessage* message, StorageInfoResponse* response) override;
+
+    grpc::ServerBidiReactor<SessionRequest, SessionResponse>* oram_session(grpc::CallbackServerContext* context) override;
+
+    grpc::ServerUnaryReactor* insert_handler(grpc::CallbackServerContext* context, const InsertMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::ServerUnaryReactor* select_handler(grpc::CallbackServerContext* context, const SelectMessage* message, SelectResult* reponse) override;
+
+    /**
+     * @see SealCore::checkpoint
+     */
+    bool checkpoint();
+};
+
+#endif
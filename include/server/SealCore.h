@@ -0,0 +1,225 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_CORE_H
+#define SEAL_CORE_H
+
+#include <grpc++/support/status.h>
+
+#include <Connector.h>
+#include <oram/OramStruct.h>
+#include <proto/seal.pb.h>
+#include <oram/Bucket.h>
+#include <server/BucketStoreInterface.h>
+#include <server/SnapshotDirectory.h>
+#include <server/StorageOptions.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Marks a sub-ORAM that has no storage yet.
+ */
+#define NO_HANDLE UINT64_MAX
+
+/**
+ * @brief The state and the request handling of the server, shared by the synchronous and the callback service.
+ *
+ * Every handler serves one request message and may be called from any thread.
+ */
+class SealCore {
+private:
+    std::unique_ptr<SEAL::Connector> connector;
+
+    /**
+     * @brief Guards the connector, which is neither thread-safe nor stable across setup calls.
+     */
+    std::mutex connector_lock;
+
+    const StorageOptions options;
+
+    /**
+     * @brief Saves the trees in memory, if checkpoints are enabled.
+     */
+    std::unique_ptr<SnapshotDirectory> snapshots;
+
+    /**
+     * @brief Runs one checkpoint at a time.
+     */
+    std::mutex checkpoint_lock;
+
+    std::thread checkpoint_thread;
+
+    std::mutex stop_lock;
+
+    std::condition_variable stop_condition;
+
+    bool stopping;
+
+    std::mutex capacity_lock;
+
+    /**
+     * @brief A bucket store together with the reader/writer lock serializing its accesses.
+     * 
+     * @note Handlers hold the entry by shared pointer so that a concurrent set_capacity
+     *       replacing the store does not free it underneath them.
+     */
+    struct StorageEntry {
+        std::unique_ptr<BucketStoreInterface> store;
+
+        std::shared_mutex lock;
+    };
+
+    /**
+     * @brief Guards the storage table and the registries below. Requests only take it shared for one lookup.
+     */
+    std::shared_mutex storage_lock;
+
+    /**
+     * @brief The storage of every ORAM, indexed by the handle that set_capacity returns.
+     */
+    std::vector<std::shared_ptr<StorageEntry>> storage;
+
+    /**
+     * @brief The handle of the oblivious dictionary of each map key.
+     */
+    std::map<std::string, uint64_t> odict_handles;
+
+    /**
+     * @brief The handles of the ORAM blocks (sub-divided) of each map key, indexed by oram_id.
+     */
+    std::map<std::string, std::vector<uint64_t>> oram_handles;
+
+    /**
+     * @brief Look up the bucket array that a request refers to.
+     * 
+     * @throw std::out_of_range if the handle was not returned by set_capacity.
+     */
+    std::shared_ptr<StorageEntry> get_storage(const uint64_t& handle);
+
+    /**
+     * @brief Get the handle of an ORAM, registering it if it is new. The caller holds the storage lock.
+     * 
+     * @throw std::out_of_range if the ORAM ID skips a sub-ORAM.
+     */
+    uint64_t reserve_handle(const bool& is_odict, const unsigned int& oram_id, const std::string& map_key);
+
+    /**
+     * @brief Tell what an ORAM tree belongs to, so that its handle is registered again when it is reopened.
+     */
+    std::string tree_label(const bool& is_odict, const unsigned int& oram_id, const std::string& map_key);
+
+    std::string tree_path(const uint64_t& handle);
+
+    std::unique_ptr<BucketStoreInterface> create_store(
+        const uint64_t& handle, const std::string& label,
+        const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size);
+
+    /**
+     * @brief The memory budget left for the tree of the handle, not counting the tree it replaces.
+     */
+    size_t memory_available(const uint64_t& handle);
+
+    /**
+     * @brief Reopen the trees in the storage directory under the handles they had before.
+     */
+    void restore_storage();
+
+    /**
+     * @brief Register a tree that was saved before under the label of its owner.
+     */
+    void register_tree(const uint64_t& handle, const std::string& label, std::unique_ptr<BucketStoreInterface> store);
+
+    /**
+     * @brief Give the sub-ORAMs missing among the registered trees an empty handle that set_capacity can fill.
+     */
+    void fill_handles();
+
+    /**
+     * @brief Take a checkpoint at every interval of milliseconds until the service stops.
+     */
+    void checkpoint_periodically(const unsigned int& interval);
+
+    void print_blocks(const BucketStoreInterface& storage);
+
+public:
+    SealCore(const StorageOptions& options = StorageOptions());
+
+    ~SealCore();
+
+    grpc::Status setup(const SetupMessage* request, google::protobuf::Empty* e);
+
+    grpc::Status set_capacity(const BucketSetMessage* message, BucketSetResponse* response);
+
+    grpc::Status read_bucket(const BucketReadMessage* message, BucketReadResponse* reponse);
+
+    grpc::Status write_bucket(const BucketWriteMessage* message, google::protobuf::Empty* e);
+
+    grpc::Status read_path(const PathReadMessage* message, PathReadResponse* response);
+
+    grpc::Status write_path(const PathWriteMessage* message, google::protobuf::Empty* e);
+
+    grpc::Status read_path_blocks(const PathBlocksReadMessage* message, PathBlocksReadResponse* response);
+
+    grpc::Status read_buckets(const BucketsReadMessage* message, BucketsReadResponse* response);
+
+    grpc::Status write_buckets(const BucketsWriteMessage* message, google::protobuf::Empty* e);
+
+    /**
+     * @brief Apply the bucket writes of several storages and then serve their reads, each as write_buckets and
+     *        read_buckets would.
+     */
+    grpc::Status vectored_access(const VectoredMessage* message, VectoredResponse* response);
+
+    /**
+     * @brief Write one chunk of a tree that is streamed by load_buckets.
+     */
+    grpc::Status load_buckets(const BucketsWriteMessage* message);
+
+    grpc::Status storage_info(const StorageInfoMessage* message, StorageInfoResponse* response);
+
+    /**
+     * @brief Serve one request of an ORAM session as the corresponding unary call would, reporting its status in
+     *        the response.
+     */
+    void oram_session(const SessionRequest* request, SessionResponse* response);
+
+    grpc::Status insert_handler(const InsertMessage* message, google::protobuf::Empty* e);
+
+    grpc::Status select_handler(const SelectMessage* message, SelectResult* reponse);
+
+    /**
+     * @brief Make the storage durable: the trees in memory are saved to the checkpoint directory if there is
+     *        one, and the trees in files are flushed.
+     *
+     * @return whether every tree was saved; errors are logged.
+     */
+    bool checkpoint();
+
+    /**
+     * @brief Whether the bucket operations may wait for the disk, which they do unless the trees are in memory.
+     */
+    bool buckets_on_disk() const;
+
+    void print_oram_blocks();
+};
+
+#endif
\ No newline at end of file
@@ -21,22 +21,70 @@
 #include <string>
 #include <memory>
 
-#include <server/SealService.h>
+#include <proto/seal.grpc.pb.h>
+#include <server/SealCallbackService.h>
+#include <server/SealCore.h>
 
 #include <signal.h>
 #include <grpc++/server.h>
 #include <grpc++/server_builder.h>
 
+/**
+ * @brief How long calls in flight, such as ORAM sessions, may go on once the server is told to stop.
+ */
+#define SHUTDOWN_GRACE_SECONDS 5
+
+enum ServiceMode {
+    SYNC_SERVICE,
+    CALLBACK_SERVICE
+};
+
+/**
+ * @brief How the server takes requests.
+ */
+struct ServerOptions {
+    /**
+     * @brief The synchronous service takes a thread for every call in flight, the callback service does not.
+     */
+    ServiceMode mode = SYNC_SERVICE;
+
+    /**
+     * @brief The number of threads polling for requests of the synchronous service. 0 keeps the gRPC default.
+     */
+    unsigned int pollers = 0;
+
+    /**
+     * @brief The largest number of threads that the synchronous service may use. 0 means that there is no limit.
+     */
+    unsigned int max_threads = 0;
+
+    /**
+     * @brief The number of threads of the callback service that run the handlers which may block.
+     */
+    unsigned int workers = CALLBACK_WORKERS;
+};
+
 class SealServerRunner {
 private:
     std::unique_ptr<grpc::Server> server;
 
-    std::unique_ptr<SealService> service;
-public:
+    std::shared_ptr<SealCore> core;
 
-    void sig_handler(int s);
+    std::unique_ptr<grpc::Service> service;
+public:
 
-    void run(const std::string& address);
+    /**
+     * @brief Serve on address until SIGINT, then shut the server down and checkpoint the storage.
+     *
+     * @note SIGINT is blocked in the calling thread and every thread started afterwards; a dedicated thread
+     *       takes it with sigwait(), so nothing runs inside a signal handler.
+     *
+     * @param options Where the service keeps the ORAM trees.
+     * @param server_options How the service takes requests.
+     */
+    void run(
+        const std::string& address, const StorageOptions& options = StorageOptions(),
+        const ServerOptions& server_options = ServerOptions());
 
     SealServerRunner() = default;
 
@@ -21,50 +21,66 @@
 #include <grpc++/server.h>
 #include <grpc++/server_context.h>
 
-#include <Connector.h>
-#include <oram/OramStruct.h>
 #include <proto/seal.grpc.pb.h>
 #include <proto/seal.pb.h>
-#include <oram/Bucket.h>
+#include <server/SealCore.h>
 
 #include <memory>
-#include <vector>
 
+/**
+ * @brief The synchronous service, which serves every call on a thread of its own.
+ */
 class SealService : public Seal::Service {
 private:
-    std::unique_ptr<SEAL::Connector> connector;
-
-    /**
-     * @brief The storage array provided by the server.
-     */ 
-    std::map<std::string, std::vector<Bucket>> odict_storage;
-
-
-    /**
-     * @brief The ORAM block (sub-divided) array provided by the server.
-     * 
-     * @note This is a two-dimensional array. [oram_id][bucket_index]
-     */ 
-    std::map<std::string, std::vector<std::vector<Bucket>>> oram_storage;
+    const std::shared_ptr<SealCore> core;
 
 public:
-    SealService();
+    SealService(const StorageOptions& options = StorageOptions());
 
-    virtual ~SealService();
+    /**
+     * @param core The state of the server, which may be shared with another service.
+     */
+    SealService(const std::shared_ptr<SealCore>& core);
 
     grpc::Status setup(grpc::ServerContext* context, const SetupMessage* request, google::protobuf::Empty* e) override;
 
-    grpc::Status set_capacity(grpc::ServerContext* context, const BucketSetMessage* message, google::protobuf::Empty* e) override;
+    grpc::Status set_capacity(grpc::ServerContext* context, const BucketSetMessage* message, BucketSetResponse* response) override;
 
     grpc::Status read_bucket(grpc::ServerContext* context, const BucketReadMessage* message, BucketReadResponse* reponse) override;
 
     grpc::Status write_bucket(grpc::ServerContext* context, const BucketWriteMessage* message, google::protobuf::Empty* e) override;
 
+    grpc::Status read_path(grpc::ServerContext* context, const PathReadMessage* message, PathReadResponse* response) override;
+
+    grpc::Status write_path(grpc::ServerContext* context, const PathWriteMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::Status read_path_blocks(grpc::ServerContext* context, const PathBlocksReadMessage* message, PathBlocksReadResponse* response) override;
+
+    grpc::Status read_buckets(grpc::ServerContext* context, const BucketsReadMessage* message, BucketsReadResponse* response) override;
+
+    grpc::Status write_buckets(grpc::ServerContext* context, const BucketsWriteMessage* message, google::protobuf::Empty* e) override;
+
+    grpc::Status vectored_access(grpc::ServerContext* context, const VectoredMessage* message, VectoredResponse* response) override;
+
+    grpc::Status load_buckets(grpc::ServerContext* context, grpc::ServerReader<BucketsWriteMessage>* reader, google::protobuf::Empty* e) override;
+
+    grpc::Status storage_info(grpc::ServerContext* context, const StorageInfoMessage* message, StorageInfoResponse* response) override;
+
+    /**
+     * @brief Serve the bucket operations of one client in order, each as the corresponding unary call would.
+     */
+    grpc::Status oram_session(grpc::ServerContext* context, grpc::ServerReaderWriter<SessionResponse, SessionRequest>* stream) override;
+
     grpc::Status insert_handler(grpc::ServerContext* context, const InsertMessage* message, google::protobuf::Empty* e) override;
 
     grpc::Status select_handler(grpc::ServerContext* context, const SelectMessage* message, SelectResult* reponse) override;
 
+    /**
+     * @see SealCore::checkpoint
+     */
+    bool checkpoint();
+
     void print_oram_blocks();
 };
 
-#endif
\ No newline at end of file
+#endif
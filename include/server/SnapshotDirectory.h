@@ -0,0 +1,125 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_SNAPSHOT_DIRECTORY_H
+#define SEAL_SNAPSHOT_DIRECTORY_H
+
+#include "MappedBucketStore.h"
+#include "MemoryBucketStore.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The file listing the snapshot of every tree in the latest checkpoint.
+ */
+#define SNAPSHOT_MANIFEST "MANIFEST"
+
+/**
+ * @brief Opens a journal, and closes it once it is complete.
+ */
+static const char JOURNAL_MAGIC[8] = { 'S', 'E', 'A', 'L', 'J', 'R', 'N', 'L' };
+
+/**
+ * @brief The header of the journal of a snapshot. The records follow it, and the magic is repeated after
+ *        the last record once the journal is complete.
+ *        A record is the position of a bucket as a uint64_t, followed by the bucket.
+ */
+struct JournalHeader {
+    char magic[8];
+
+    uint64_t count;
+
+    uint64_t bucket_size;
+};
+
+/**
+ * @brief Saves the trees held in memory to a directory of snapshots, and loads them back.
+ *
+ * A snapshot is a tree file in heap order (@see MappedBucketStore). The first save of a tree writes it whole
+ * under a fresh name; later saves only write the buckets that changed. They are first written to a journal,
+ * so that a crash in the middle leaves either the old or the new tree behind, and then applied in place;
+ * the journal is removed once the snapshot has been synced.
+ * The manifest is replaced atomically at the end of every checkpoint and tells which snapshots belong to it.
+ *
+ * @note The class is not thread-safe; the caller runs one checkpoint at a time.
+ */
+class SnapshotDirectory {
+private:
+    struct Snapshot {
+        std::string name;
+
+        std::unique_ptr<MappedBucketStore> file;
+    };
+
+    const std::string directory;
+
+    /**
+     * @brief The snapshot of every tree, by handle.
+     */
+    std::map<uint64_t, Snapshot> snapshots;
+
+    /**
+     * @brief Snapshots that are replaced by newer ones once the manifest is committed.
+     */
+    std::vector<std::string> obsolete;
+
+    /**
+     * @brief Numbers the snapshots, so that a new one never overwrites a snapshot in the manifest.
+     */
+    uint64_t generation;
+
+    std::string path(const std::string& name) const;
+
+    void write_journal(const std::string& name, const MemoryBucketStore& store, const std::vector<size_t>& positions);
+
+    /**
+     * @brief Apply the journal of a snapshot if it is complete, and remove it either way.
+     */
+    void replay_journal(const std::string& name, MappedBucketStore& file);
+
+public:
+    SnapshotDirectory(const std::string& directory);
+
+    /**
+     * @brief Load the trees of the latest checkpoint and drop the files that do not belong to it.
+     *
+     * @return the trees by handle, with the labels they were saved with.
+     * @throw std::runtime_error if a snapshot in the manifest is damaged.
+     */
+    std::map<uint64_t, std::pair<std::string, std::unique_ptr<MemoryBucketStore>>> restore(const bool& huge_pages);
+
+    /**
+     * @brief Save a tree, whole if it has not been saved before and its dirty buckets otherwise.
+     *
+     * @note Writes to the store must be held off.
+     * @throw std::system_error on an I/O error.
+     */
+    void save(const uint64_t& handle, const std::string& label, MemoryBucketStore& store);
+
+    /**
+     * @brief Make the snapshots saved so far the latest checkpoint.
+     *
+     * @throw std::system_error on an I/O error.
+     */
+    void commit();
+};
+
+#endif // SEAL_SNAPSHOT_DIRECTORY_H
@@ -0,0 +1,97 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_STORAGE_OPTIONS_H
+#define SEAL_STORAGE_OPTIONS_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Where the server keeps the buckets of the ORAM trees.
+ */
+enum StorageBackend {
+    /* In anonymous memory; everything is lost when the server stops. */
+    MEMORY_STORAGE,
+    /* In one memory-mapped file per tree, which is reopened when the server starts again. */
+    MAPPED_STORAGE,
+    /* The top levels of every tree in memory, as far as the memory budget goes, and the rest in a scratch file. */
+    TIERED_STORAGE,
+};
+
+/**
+ * @brief When the writes to a memory-mapped tree are flushed to the disk.
+ */
+enum SyncPolicy {
+    /* Leave it to the kernel; the trees survive a restart of the server but not a crash of the machine. */
+    SYNC_NONE,
+    /* Flush every tree every sync_interval milliseconds. */
+    SYNC_PERIODIC,
+    /* Flush the pages of every bucket before the write is acknowledged. */
+    SYNC_WRITE,
+};
+
+struct StorageOptions {
+    StorageBackend backend = MEMORY_STORAGE;
+
+    /**
+     * @brief Back the in-memory storage with huge pages when the system provides them.
+     */
+    bool huge_pages = false;
+
+    /**
+     * @brief The number of bytes of memory that all trees together may take, or 0 for no limit.
+     *
+     * A tree in memory that does not fit is refused; a tiered tree keeps as many levels in memory as fit.
+     */
+    size_t memory_budget = 0;
+
+    /**
+     * @brief The directory holding the files of the memory-mapped and tiered trees.
+     */
+    std::string directory = "data";
+
+    SyncPolicy sync_policy = SYNC_NONE;
+
+    unsigned int sync_interval = 1000;
+
+    /**
+     * @brief The directory to which the trees in memory are saved, or empty to keep them in memory only.
+     *
+     * The trees are loaded back from there when the server starts.
+     */
+    std::string checkpoint_directory;
+
+    /**
+     * @brief The number of milliseconds between checkpoints in the background, or 0 to only take them on demand.
+     */
+    unsigned int checkpoint_interval = 0;
+
+    /**
+     * @brief The number of levels of the subtrees packed together in the files of new trees, or 0 for heap order.
+     *
+     * A subtree of k levels fills about (2^k - 1) buckets, so k is best chosen such that this is a few pages.
+     */
+    unsigned int subtree_levels = 0;
+
+    /**
+     * @brief The number of levels at the top of every memory-mapped tree that are locked in memory.
+     */
+    unsigned int cached_levels = 0;
+};
+
+#endif // SEAL_STORAGE_OPTIONS_H
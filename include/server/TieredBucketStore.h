@@ -0,0 +1,94 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEAL_TIERED_BUCKET_STORE_H
+#define SEAL_TIERED_BUCKET_STORE_H
+
+#include "BucketStoreInterface.h"
+#include "MemoryBucketStore.h"
+
+#include <string>
+
+/**
+ * @brief Keeps the top levels of one ORAM tree in memory and the levels below them in a file.
+ *
+ * Every access reads and writes the whole top of the tree, so the levels in memory take most of the load,
+ * while the much larger bottom of the tree costs no memory beyond what the page cache chooses to keep.
+ * The file is a scratch file: it is unlinked as soon as it is created, and the tree does not outlive the store.
+ */
+class TieredBucketStore : public BucketStoreInterface {
+private:
+    MemoryBucketStore hot;
+
+    /**
+     * @brief The file holding the buckets below the levels in memory.
+     */
+    int fd;
+
+    const size_t num_buckets;
+
+    const size_t slots_per_bucket;
+
+    const size_t slot_size;
+
+    void check_position(const size_t& position) const;
+
+public:
+    /**
+     * @brief Create a store whose slots are all dummies.
+     *
+     * @param directory Where the file for the levels on disk is created.
+     * @param num_buckets
+     * @param slots_per_bucket
+     * @param block_size the size of the payload of a slot.
+     * @param memory_levels The number of levels at the top of the tree that are kept in memory.
+     * @param huge_pages Back the levels in memory with huge pages when the system provides them.
+     * @throw std::system_error if the file cannot be created.
+     */
+    TieredBucketStore(
+        const std::string& directory, const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+        const size_t& memory_levels, const bool& huge_pages = false);
+
+    TieredBucketStore(const TieredBucketStore&) = delete;
+
+    TieredBucketStore& operator=(const TieredBucketStore&) = delete;
+
+    ~TieredBucketStore();
+
+    size_t size() const;
+
+    size_t num_slots() const;
+
+    size_t block_size() const;
+
+    size_t bucket_size() const;
+
+    size_t memory_size() const;
+
+    size_t disk_size() const;
+
+    /**
+     * @throw std::system_error on an I/O error of the file.
+     */
+    void read(const size_t& position, char* destination) const;
+
+    void read_slot(const size_t& position, const size_t& offset, char* destination) const;
+
+    void write(const size_t& position, std::string_view bucket);
+};
+
+#endif // SEAL_TIERED_BUCKET_STORE_H
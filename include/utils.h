@@ -79,6 +79,38 @@ std::vector<unsigned int> pseudo_random_permutation(const size_t& value_size, st
 
 std::pair<unsigned int, unsigned int> get_bits(const unsigned int& base, const unsigned int& number, const unsigned int& alpha);
 
+/**
+ * @brief Locate a bucket on a path of a binary ORAM tree stored in heap order.
+ *
+ * @param leaf the leaf in range 0 to 2^(num_levels - 1) - 1.
+ * @param level the level in range 0 (root) to num_levels - 1.
+ * @param num_levels the height of the tree.
+ * @return the position of the bucket in the bucket array.
+ */
+int get_bucket_position(const int& leaf, const int& level, const int& num_levels);
+
+/**
+ * @brief Recover the height of a full binary ORAM tree from its number of buckets.
+ */
+int get_num_levels(const size_t& num_buckets);
+
+/**
+ * @brief Read a whole range of a file, retrying short reads.
+ * @throw std::system_error on an I/O error or at the end of the file.
+ */
+void read_fully(const int& fd, char* buffer, const size_t& size, const size_t& offset);
+
+/**
+ * @brief Write a whole range of a file, retrying short writes.
+ * @throw std::system_error on an I/O error.
+ */
+void write_fully(const int& fd, const char* buffer, const size_t& size, const size_t& offset);
+
+/**
+ * @brief Get the g-th leaf in reverse lexicographic order, which spreads consecutive evictions over the tree.
+ */
+int get_reverse_lexicographic_leaf(const unsigned int& g, const int& num_levels);
+
 std::string encrypt_message(std::string_view key, std::string_view message, const unsigned char* nonce);
 
 std::string decrypt_message(std::string_view key, std::string_view ciphertext, const unsigned char* nonce, const size_t& raw_length);
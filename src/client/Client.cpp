@@ -16,7 +16,7 @@
  */
 
 #include <client/Client.h>
-#include <crypto/sm4.h>
+#include <client/OramAccessScheduler.h>
 #include <parser/rapidcsv.h>
 #include <plog/Log.h>
 #include <utils.h>
@@ -30,6 +30,7 @@
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <random>
 #include <sstream>
 #include <stdexcept>
@@ -57,8 +58,9 @@ void SEAL::Client::init_dummy_data()
 {
     PLOG(plog::info) << "Initializing dummy data!";
 
-    ODict::Node* test_root = new ODict::Node(0, -1);
-    std::string data = serialize<ODict::Node>(*test_root);
+    ODict::Node test_root(0, -1);
+    seal_node(test_root);
+    std::string data = serialize<ODict::Node>(test_root);
     oramAccessController.get()->oblivious_access(ORAM_ACCESS_WRITE, 0, data);
 }
 
@@ -82,7 +84,11 @@ void SEAL::Client::init_key(std::string_view password)
         }
 
         secret_key = std::string((char*)key, crypto_box_SEEDBYTES);
-        PLOG(plog::info) << "Key sampled: " << secret_key;
+        cipher = std::make_unique<AeadCipher>(secret_key);
+
+        unsigned char bucket[16];
+        crypto_kdf_derive_from_key(bucket, sizeof(bucket), BUCKET_KDF_SUBKEY_ID, AEAD_KDF_CONTEXT, key);
+        bucket_key = std::string((char*)bucket, sizeof(bucket));
     } catch (const std::runtime_error& e) {
         PLOG(plog::error) << e.what();
         std::cout << e.what();
@@ -175,10 +181,50 @@ void SEAL::Client::cache_helper(const int& id, ODict::Node* const ret)
     std::string buffer = serialize<ODict::Node>(ODict::Node(id, pos));
     oramAccessController.get()->oblivious_access_direct(ORAM_ACCESS_READ, buffer);
     *ret = deserialize<ODict::Node>(buffer);
-    const std::string plaintext = decrypt_SM4_EBC(ret->data, secret_key);
-    const std::string key = decrypt_SM4_EBC(ret->key, secret_key);
-    ret->data = plaintext;
-    ret->key = key;
+    open_node(*ret, id);
+}
+
+size_t SEAL::Client::odict_block_size(const size_t& key_size, const size_t& data_size) const
+{
+    // The other fields of a node have a fixed width, so the longest key and data give the largest node.
+    // A sealed node keeps no key, and its data is the pair of both sealed, i.e. AEAD_OVERHEAD bytes longer.
+    const std::string fields = serialize(std::make_pair(std::string(key_size, '\0'), std::string(data_size, '\0')));
+    ODict::Node node(0, -1);
+    node.data = std::string(fields.size() + AEAD_OVERHEAD, '\0');
+    return std::max(block_size, serialize<ODict::Node>(node).size());
+}
+
+void SEAL::Client::seal_node(ODict::Node& node) const
+{
+    node.data = cipher->encrypt(serialize(std::make_pair(node.key, node.data)), std::to_string(node.id));
+    node.key.clear();
+}
+
+void SEAL::Client::open_node(ODict::Node& node, const int& id) const
+{
+    const auto fields = deserialize<std::pair<std::string, std::string>>(cipher->decrypt(node.data, std::to_string(id)));
+    node.key = fields.first;
+    node.data = fields.second;
+}
+
+/**
+ * @brief The associated data of a document, which starts with the numbers so that no column can forge another place.
+ */
+static std::string document_place(const std::string& map_key, const unsigned int& oram_id, const int& index)
+{
+    return std::to_string(oram_id) + '#' + std::to_string(index) + '#' + map_key;
+}
+
+std::string SEAL::Client::seal_document(
+    const SEAL::Document& document, const std::string& map_key, const unsigned int& oram_id, const int& index) const
+{
+    return cipher->encrypt(serialize<SEAL::Document>(document), document_place(map_key, oram_id, index));
+}
+
+SEAL::Document SEAL::Client::open_document(
+    const std::string& block, const std::string& map_key, const unsigned int& oram_id, const int& index) const
+{
+    return deserialize<SEAL::Document>(cipher->decrypt(block, document_place(map_key, oram_id, index)));
 }
 
 void SEAL::Client::ODS_start() { cache->clear(); }
@@ -207,13 +253,10 @@ void SEAL::Client::ODS_finalize(const int& pad_val)
     while (!cache->empty()) {
         ODict::Node node = cache->get();
         // We store a node as a char array.
-        const std::string ciphertext = encrypt_SM4_EBC(node.data, secret_key);
-        const std::string encrypted_key = encrypt_SM4_EBC(node.key, secret_key);
-        node.data = ciphertext;
-        node.key = encrypted_key;
+        seal_node(node);
+        PLOG(plog::debug) << "evicting " << node.id;
 
         std::string buffer = serialize<ODict::Node>(node);
-        PLOG(plog::debug) << "evicting " << node.id << "with data " << node.data << " key = " << node.key;
         oramAccessController.get()->oblivious_access_direct(ORAM_ACCESS_WRITE,
             buffer);
         cache->pop();
@@ -223,9 +266,10 @@ void SEAL::Client::ODS_finalize(const int& pad_val)
     // Pad add to padVal.
 
     for (int i = pad_val - write_count; i <= pad_val; i++) {
-        // dummy operation.
-        ODict::Node* node = new ODict::Node(0, -1);
-        std::string data = serialize<ODict::Node>(*node);
+        // dummy operation, sealed like the node it overwrites so that block 0 still opens.
+        ODict::Node node(0, -1);
+        seal_node(node);
+        std::string data = serialize<ODict::Node>(node);
         oramAccessController.get()->oblivious_access(ORAM_ACCESS_WRITE, 0, data);
     }
 
@@ -652,11 +696,6 @@ void SEAL::Client::adj_data_in(std::string_view file_path)
 {
     /*  */
     try {
-        oramAccessController = std::make_unique<OramAccessController>(
-            bucket_size, block_number, block_size, -1, true, (std::string)file_path, stub_);
-        cache = new Cache<ODict::Node>(INT_MAX, oramAccessController.get());
-        init_dummy_data();
-
         PLOG(plog::debug) << "Reading data...";
         std::vector<std::pair<std::string, SEAL::Document>> memory;
         rapidcsv::Document doc(file_path.data(), rapidcsv::LabelParams(0, -1));
@@ -757,6 +796,7 @@ void SEAL::Client::adj_insert(
     const std::string& map_key)
 {
     std::vector<ODict::Node*> nodes;
+    size_t key_size = 0, data_size = 0;
     for (unsigned int i = 0; i < memory.size(); i++) {
         /* Build the secret index. */
         ODict::Node* const node = new ODict::Node();
@@ -767,10 +807,19 @@ void SEAL::Client::adj_insert(
         node->key = memory[i].first;
         node->data = data;
         nodes.push_back(node);
+        key_size = std::max(key_size, node->key.size());
+        data_size = std::max(data_size, node->data.size());
 
         /* Insert into the remote database. */
     }
 
+    /* Every block of the oblivious dictionary has room for the largest node of the index. */
+    oramAccessController = std::make_unique<OramAccessController>(
+        bucket_size, block_number, odict_block_size(key_size, data_size), -1, true, map_key, stub_,
+        ORAM_TYPE_PATH, 0, 0, false, false, 0, bucket_key);
+    cache = new Cache<ODict::Node>(INT_MAX, oramAccessController.get());
+    init_dummy_data();
+
     insert(nodes);
 
     adj_oram_init(memory, map_key);
@@ -805,17 +854,23 @@ void SEAL::Client::adj_oram_init_helper_range(
     const std::string& map_key)
 {
     try {
+        /* Every block of the sub-ORAMs has room for the largest encrypted document */
+        std::vector<std::vector<std::pair<unsigned int, std::string>>> blocks(sub_arrays.size());
+        size_t document_size = 0;
         for (unsigned int i = 0; i < sub_arrays.size(); i++) {
-            /* Initialize local oram access controllers */
-            adj_oramAccessControllers_range[map_key].emplace_back(
-                new OramAccessController(bucket_size, block_number, sizeof(unsigned int), i, false, map_key, stub_));
-
+            blocks[i].reserve(sub_arrays[i].size());
             for (unsigned int j = 0; j < sub_arrays[i].size(); j++) {
-                std::string data = encrypt_SM4_EBC(serialize<SEAL::Document>(sub_arrays[i][j]), secret_key);
-                adj_oramAccessControllers_range[map_key][i].get()->oblivious_access(
-                    OramAccessOp::ORAM_ACCESS_WRITE, j, data);
+                blocks[i].emplace_back(j, seal_document(sub_arrays[i][j], map_key, i, j));
+                document_size = std::max(document_size, blocks[i].back().second.size());
             }
         }
+
+        for (unsigned int i = 0; i < sub_arrays.size(); i++) {
+            /* Initialize local oram access controllers, which bulk-load the sub-array */
+            adj_oramAccessControllers_range[map_key].emplace_back(
+                new OramAccessController(bucket_size, block_number, document_size, i, false, map_key, blocks[i], stub_,
+                    ORAM_TYPE_PATH, 0, 0, false, false, 0, bucket_key));
+        }
     } catch (const std::runtime_error& e) {
         PLOG(plog::error) << e.what();
     }
@@ -826,17 +881,24 @@ void SEAL::Client::adj_oram_init_helper(
     const std::string& map_key)
 {
     try {
+        /* Every block of the sub-ORAMs has room for the largest encrypted document */
+        std::vector<std::vector<std::pair<unsigned int, std::string>>> blocks(sub_arrays.size());
+        size_t document_size = 0;
         for (unsigned int i = 0; i < sub_arrays.size(); i++) {
-            /* Initialize local oram access controllers */
-            adj_oramAccessControllers.emplace_back(
-                new OramAccessController(bucket_size, block_number, sizeof(unsigned int), i, false, map_key, stub_));
-
+            blocks[i].reserve(sub_arrays[i].size());
             for (unsigned int j = 0; j < sub_arrays[i].size(); j++) {
-                std::string data = encrypt_SM4_EBC(serialize<SEAL::Document>(sub_arrays[i][j]), secret_key);
-                adj_oramAccessControllers[i].get()->oblivious_access(
-                    OramAccessOp::ORAM_ACCESS_WRITE, j, data);
+                blocks[i].emplace_back(j, seal_document(sub_arrays[i][j], map_key, i, j));
+                document_size = std::max(document_size, blocks[i].back().second.size());
             }
         }
+
+        for (unsigned int i = 0; i < sub_arrays.size(); i++) {
+            /* Initialize local oram access controllers, which bulk-load the sub-array */
+            adj_oramAccessControllers.emplace_back(
+                new OramAccessController(bucket_size, block_number, document_size, i, false, map_key, blocks[i], stub_,
+                    ORAM_TYPE_PATH, 0, 0, false, false, 0, bucket_key));
+        }
+        adj_map_key = map_key;
     } catch (const std::runtime_error& e) {
         PLOG(plog::error) << e.what();
     }
@@ -891,18 +953,29 @@ SEAL::Client::search(std::string_view keyword)
     std::vector<SEAL::Document> ans;
 
     const std::vector<unsigned int> prp = pseudo_random_permutation(memory_size, secret_key);
+    /* Group the reads by sub-ORAM so that each of them is accessed in a single batch, and all batches together. */
+    std::map<unsigned int, std::vector<int>> addresses;
     for (unsigned int i = iw; i <= iw + countw; i++) {
         const unsigned int value = prp[i];
         const std::pair<unsigned int, unsigned int> bits = get_bits(base, value, alpha);
+        addresses[bits.first].push_back(bits.second);
+    }
 
-        std::string res;
-        adj_oramAccessControllers[bits.first].get()->oblivious_access(
-            OramAccessOp::ORAM_ACCESS_READ, bits.second, res);
-        res = decrypt_SM4_EBC(res, secret_key);
-        SEAL::Document doc = deserialize<SEAL::Document>(res);
-        /* Filter out dummy records. */
-        if (doc.id < memory_size) {
-            ans.push_back(doc);
+    OramAccessScheduler scheduler(stub_);
+    std::map<unsigned int, std::vector<std::string>> results;
+    for (auto iter = addresses.begin(); iter != addresses.end(); iter++) {
+        scheduler.schedule(
+            adj_oramAccessControllers[iter->first].get(), OramAccessOp::ORAM_ACCESS_READ, iter->second, results[iter->first]);
+    }
+    scheduler.execute();
+
+    for (auto iter = results.begin(); iter != results.end(); iter++) {
+        for (size_t i = 0; i < iter->second.size(); i++) {
+            SEAL::Document doc = open_document(iter->second[i], adj_map_key, iter->first, addresses[iter->first][i]);
+            /* Filter out dummy records. */
+            if (doc.id < memory_size) {
+                ans.push_back(doc);
+            }
         }
     }
 
@@ -953,16 +1026,26 @@ SEAL::Client::search_range_helper(
     auto begin = std::chrono::high_resolution_clock::now();
     const std::vector<unsigned int> prp = pseudo_random_permutation(kwd_size[map_key.data()], secret_key);
 
+    std::map<unsigned int, std::vector<int>> addresses;
     for (unsigned int i = 0; i < doc_subscripts.size(); i++) {
         const unsigned int value = prp[doc_subscripts[i]];
         const std::pair<unsigned int, unsigned int> bits = get_bits(base, value, alpha);
+        addresses[bits.first].push_back(bits.second);
+    }
 
-        std::string res;
-        adj_oramAccessControllers_range[map_key.data()][bits.first].get()->oblivious_access(
-            OramAccessOp::ORAM_ACCESS_READ, bits.second, res);
-        res = decrypt_SM4_EBC(res, secret_key);
-        SEAL::Document doc = deserialize<SEAL::Document>(res);
-        ans.push_back(doc);
+    OramAccessScheduler scheduler(stub_);
+    std::map<unsigned int, std::vector<std::string>> results;
+    for (auto iter = addresses.begin(); iter != addresses.end(); iter++) {
+        scheduler.schedule(
+            adj_oramAccessControllers_range[map_key.data()][iter->first].get(), OramAccessOp::ORAM_ACCESS_READ,
+            iter->second, results[iter->first]);
+    }
+    scheduler.execute();
+
+    for (auto iter = results.begin(); iter != results.end(); iter++) {
+        for (size_t i = 0; i < iter->second.size(); i++) {
+            ans.push_back(open_document(iter->second[i], map_key.data(), iter->first, addresses[iter->first][i]));
+        }
     }
 
     auto end = std::chrono::high_resolution_clock::now();
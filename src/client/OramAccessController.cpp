@@ -16,9 +16,15 @@
  */
 
 #include <client/OramAccessController.h>
+#include <oram/AsyncServerStorage.h>
+#include <oram/BoundedRandomForOram.h>
+#include <oram/CircuitOram.h>
+#include <oram/EncryptedStorage.h>
+#include <oram/OramPositionMap.h>
 #include <oram/OramReadPathEviction.h>
-#include <oram/RandomForOram.h>
+#include <oram/RingOram.h>
 #include <oram/ServerStorage.h>
+#include <oram/TreeTopCacheStorage.h>
 #include <plog/Initializers/RollingFileInitializer.h>
 #include <plog/Log.h>
 #include <utils.h>
@@ -33,7 +39,37 @@ OramAccessController::OramAccessController(
     const int& oram_id,
     const bool& is_odict,
     const std::string& key,
-    Seal::Stub* stub_)
+    Seal::Stub* stub_,
+    const OramType& oram_type,
+    const unsigned int& position_map_threshold,
+    const int& tree_top_levels,
+    const bool& async_write,
+    const bool& use_session,
+    const size_t& in_flight_window,
+    const std::string& bucket_key)
+    : OramAccessController(
+        bucket_size, block_number, block_size, oram_id, is_odict, key,
+        std::vector<std::pair<unsigned int, std::string>>(), stub_, oram_type,
+        position_map_threshold, tree_top_levels, async_write, use_session, in_flight_window, bucket_key)
+{
+}
+
+OramAccessController::OramAccessController(
+    const int& bucket_size,
+    const int& block_number,
+    const int& block_size,
+    const int& oram_id,
+    const bool& is_odict,
+    const std::string& key,
+    const std::vector<std::pair<unsigned int, std::string>>& blocks,
+    Seal::Stub* stub_,
+    const OramType& oram_type,
+    const unsigned int& position_map_threshold,
+    const int& tree_top_levels,
+    const bool& async_write,
+    const bool& use_session,
+    const size_t& in_flight_window,
+    const std::string& bucket_key)
     : oram_id(oram_id)
     , block_size(block_size)
     , is_odict(is_odict)
@@ -45,11 +81,50 @@ OramAccessController::OramAccessController(
     }
 
     PLOG(plog::info) << "Warming up OramAccessController...\n";
-    Bucket::setMaxSize(bucket_size);
 
-    storage = new ServerStorage(oram_id, is_odict, key, stub_);
-    random = RandomForOram::get_instance();
-    oram = new OramReadPathEviction(storage, random, bucket_size, block_number, block_size);
+    if (!bucket_key.empty() && oram_type == ORAM_TYPE_RING) {
+        // A sealed bucket is authenticated as a whole, so Ring ORAM would have to fetch whole paths again.
+        throw std::runtime_error("Ring ORAM reads one block per bucket and cannot be used with sealed buckets.");
+    }
+
+    const std::string oram_name = key + (is_odict ? std::string("#odict") : "#" + std::to_string(oram_id));
+
+    if (in_flight_window != 0) {
+        storage = new AsyncServerStorage(oram_id, is_odict, key, stub_, in_flight_window);
+    } else {
+        storage = new ServerStorage(oram_id, is_odict, key, stub_, async_write, use_session);
+    }
+    if (!bucket_key.empty()) {
+        storage = new EncryptedStorage(storage, bucket_key, oram_name);
+    }
+    if (tree_top_levels > 0) {
+        storage = new TreeTopCacheStorage(storage, tree_top_levels);
+    }
+    // Every ORAM sets the bound of its sampler to its own number of leaves, so none can share one.
+    random = new BoundedRandomForOram();
+
+    PositionMapInterface* position_map = nullptr;
+    if (position_map_threshold != 0 && (unsigned int)block_number > position_map_threshold) {
+        // The inner ORAMs are named after the outer one and stored as oblivious dictionaries, which are looked up by key only.
+        position_map = new OramPositionMap(
+            block_number, random, bucket_size, position_map_threshold, oram_name,
+            [stub_, bucket_key](const std::string& name) -> UntrustedStorageInterface* {
+                UntrustedStorageInterface* storage = new ServerStorage(0, true, name, stub_);
+                return bucket_key.empty() ? storage : new EncryptedStorage(storage, bucket_key, name);
+            });
+    }
+
+    switch (oram_type) {
+    case ORAM_TYPE_RING:
+        oram = new RingOram(storage, random, bucket_size, block_number, blocks, block_size, position_map);
+        break;
+    case ORAM_TYPE_CIRCUIT:
+        oram = new CircuitOram(storage, random, bucket_size, block_number, blocks, block_size, position_map);
+        break;
+    default:
+        oram = new OramReadPathEviction(storage, random, bucket_size, block_number, blocks, block_size, position_map);
+        break;
+    }
 }
 
 void OramAccessController::oblivious_access(OramAccessOp op, const int& address, std::string& data)
@@ -58,12 +133,43 @@ void OramAccessController::oblivious_access(OramAccessOp op, const int& address,
     data = oram->access(operation, address, data);
 }
 
+void OramAccessController::oblivious_access_batch(
+    OramAccessOp op, const std::vector<int>& addresses, std::vector<std::string>& data)
+{
+    data = oram->access_batch(make_batch(op, addresses, data));
+}
+
+std::vector<OramInterface::BatchOperation>
+OramAccessController::make_batch(
+    OramAccessOp op, const std::vector<int>& addresses, std::vector<std::string>& data)
+{
+    OramInterface::Operation operation = deduct_operation(op);
+    if (operation == OramInterface::Operation::WRITE && data.size() != addresses.size()) {
+        throw std::runtime_error("The number of blocks to be written does not match the number of addresses.");
+    }
+
+    std::vector<OramInterface::BatchOperation> ops(addresses.size());
+    for (size_t i = 0; i < addresses.size(); i++) {
+        ops[i].op = operation;
+        ops[i].block_index = addresses[i];
+        if (operation == OramInterface::Operation::WRITE) {
+            ops[i].data = std::move(data[i]);
+        }
+    }
+    return ops;
+}
+
 void OramAccessController::oblivious_access_direct(OramAccessOp op, std::string& data)
 {
     OramInterface::Operation operation = deduct_operation(op);
     data = oram->access_direct(operation, data);
 }
 
+void OramAccessController::flush()
+{
+    storage->flush();
+}
+
 int OramAccessController::random_new_pos()
 {
     return random->getRandomLeaf();
@@ -75,6 +181,20 @@ OramAccessController::get_random_engine()
     return random;
 }
 
+OramAccessController::~OramAccessController()
+{
+    try {
+        storage->flush();
+    } catch (const std::exception& e) {
+        PLOG(plog::error) << e.what();
+    }
+
+    // The ORAM deletes its position map, and every storage decorator deletes the storage below it.
+    delete oram;
+    delete storage;
+    delete random;
+}
+
 void OramAccessController::set_stub(Seal::Stub * stub_)
 {
     this->stub_ = stub_;
@@ -0,0 +1,139 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <client/OramAccessScheduler.h>
+
+#include <stdexcept>
+
+OramAccessScheduler::OramAccessScheduler(Seal::Stub* stub_)
+    : stub_(stub_)
+{
+}
+
+void OramAccessScheduler::schedule(
+    OramAccessController* controller, OramAccessOp op, const std::vector<int>& addresses,
+    std::vector<std::string>& data)
+{
+    Schedule& schedule = schedules[controller];
+    if (schedule.stage != Schedule::SCHEDULED) {
+        throw std::runtime_error("The ORAM has a batch that is waiting for execute to be retried.");
+    }
+
+    std::vector<OramInterface::BatchOperation> ops = controller->make_batch(op, addresses, data);
+    schedule.ops.insert(
+        schedule.ops.end(), std::make_move_iterator(ops.begin()), std::make_move_iterator(ops.end()));
+    schedule.outputs.emplace_back(&data, ops.size());
+}
+
+void OramAccessScheduler::execute()
+{
+    // Check every batch before any ORAM is remapped, so that a bad one leaves all of them as they are.
+    try {
+        for (auto iter = schedules.begin(); iter != schedules.end(); iter++) {
+            if (iter->second.stage == Schedule::SCHEDULED) {
+                iter->first->oram->check_batch(iter->second.ops);
+            }
+        }
+    } catch (const std::exception& e) {
+        // Batches already remapped by a failed execute stay, so that they can still be resumed.
+        for (auto iter = schedules.begin(); iter != schedules.end();) {
+            iter = iter->second.stage == Schedule::SCHEDULED ? schedules.erase(iter) : std::next(iter);
+        }
+        throw;
+    }
+
+    // First phase: remap the blocks and read the buckets of every ORAM together. The ORAMs outside the vectored
+    // request start their reads before anything is waited for, so that all of them overlap.
+    VectoredMessage reads;
+    for (auto iter = schedules.begin(); iter != schedules.end(); iter++) {
+        OramAccessController* const controller = iter->first;
+        Schedule& schedule = iter->second;
+
+        if (schedule.stage == Schedule::SCHEDULED) {
+            schedule.positions = controller->oram->begin_batch(schedule.ops);
+            schedule.stage = Schedule::BEGUN;
+        }
+        schedule.read = NO_READ;
+        if (schedule.stage == Schedule::BEGUN && controller->storage->is_vectored() && !schedule.positions.empty()) {
+            schedule.read = reads.reads_size();
+            controller->storage->add_read(reads, schedule.positions);
+        } else if (schedule.stage == Schedule::BEGUN && !schedule.positions.empty()) {
+            schedule.pending = controller->storage->ReadBucketsAsync(schedule.positions);
+        }
+    }
+
+    VectoredResponse response;
+    if (reads.reads_size() != 0) {
+        grpc::ClientContext context;
+        grpc::Status status = stub_->vectored_access(&context, reads, &response);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
+        if (response.reads_size() != reads.reads_size()) {
+            throw std::runtime_error("The server answered " + std::to_string(response.reads_size()) + " of " + std::to_string(reads.reads_size()) + " reads.");
+        }
+    }
+
+    // Second phase: finish every batch and write the buckets back together.
+    VectoredMessage writes;
+    for (auto iter = schedules.begin(); iter != schedules.end(); iter++) {
+        OramAccessController* const controller = iter->first;
+        Schedule& schedule = iter->second;
+
+        if (schedule.stage == Schedule::BEGUN) {
+            std::vector<Bucket> buckets;
+            if (schedule.read != NO_READ) {
+                buckets = controller->storage->take_read(*response.mutable_reads(schedule.read), schedule.positions);
+            } else if (schedule.pending.valid()) {
+                buckets = schedule.pending.get();
+            }
+
+            schedule.results = controller->oram->finish_batch(schedule.ops, buckets, schedule.evicted);
+            schedule.stage = Schedule::FINISHED;
+        }
+
+        if (schedule.stage == Schedule::FINISHED && !schedule.positions.empty()) {
+            if (controller->storage->is_vectored()) {
+                controller->storage->add_write(writes, schedule.positions, schedule.evicted);
+            } else {
+                // A storage with requests in flight of its own reports a failed write to its next access or flush.
+                controller->storage->WriteBuckets(schedule.positions, schedule.evicted);
+                schedule.stage = Schedule::WRITTEN;
+            }
+        }
+    }
+
+    if (writes.writes_size() != 0) {
+        grpc::ClientContext context;
+        VectoredResponse e;
+        grpc::Status status = stub_->vectored_access(&context, writes, &e);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
+    }
+
+    for (auto iter = schedules.begin(); iter != schedules.end(); iter++) {
+        Schedule& schedule = iter->second;
+
+        auto begin = schedule.results.begin();
+        for (const std::pair<std::vector<std::string>*, size_t>& output : schedule.outputs) {
+            output.first->assign(std::make_move_iterator(begin), std::make_move_iterator(begin + output.second));
+            begin += output.second;
+        }
+    }
+    schedules.clear();
+}
@@ -0,0 +1,103 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <crypto/aead.h>
+#include <sodium.h>
+
+static_assert(AEAD_NONCE_BYTES == crypto_aead_xchacha20poly1305_ietf_NPUBBYTES, "Wrong nonce size!");
+static_assert(AEAD_TAG_BYTES == crypto_aead_xchacha20poly1305_ietf_ABYTES, "Wrong tag size!");
+static_assert(sizeof(AEAD_KDF_CONTEXT) - 1 == crypto_kdf_CONTEXTBYTES, "Wrong KDF context size!");
+
+AeadCipher::AeadCipher(const std::string& raw_key)
+{
+    if (raw_key.size() != crypto_kdf_KEYBYTES) {
+        throw std::runtime_error("The AEAD master key must have " + std::to_string(crypto_kdf_KEYBYTES) + " bytes!");
+    }
+    if (sodium_init() < 0) {
+        throw std::runtime_error("Crypto Library cannot be initialized due to sodium initialization failure!");
+    }
+
+    crypto_kdf_derive_from_key(key, sizeof(key), AEAD_KDF_SUBKEY_ID, AEAD_KDF_CONTEXT, (const unsigned char*)raw_key.data());
+}
+
+AeadCipher::~AeadCipher()
+{
+    sodium_memzero(key, sizeof(key));
+}
+
+size_t AeadCipher::sealed_size(const size_t& plaintext_size)
+{
+    return plaintext_size + AEAD_OVERHEAD;
+}
+
+void AeadCipher::seal(unsigned char* buffer, const size_t& plaintext_size, const std::string& associated_data) const
+{
+    unsigned char* const nonce = buffer;
+    unsigned char* const message = buffer + AEAD_NONCE_BYTES;
+    randombytes_buf(nonce, AEAD_NONCE_BYTES);
+    crypto_aead_xchacha20poly1305_ietf_encrypt(message, nullptr, message, plaintext_size,
+        (const unsigned char*)associated_data.data(), associated_data.size(), nullptr, nonce, key);
+}
+
+size_t AeadCipher::open(unsigned char* buffer, const size_t& sealed_size, const std::string& associated_data) const
+{
+    if (sealed_size < AEAD_OVERHEAD) {
+        throw std::runtime_error("The ciphertext is shorter than the nonce and the tag!");
+    }
+
+    unsigned char* const nonce = buffer;
+    unsigned char* const message = buffer + AEAD_NONCE_BYTES;
+    unsigned long long plaintext_size = 0;
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt(message, &plaintext_size, nullptr, message, sealed_size - AEAD_NONCE_BYTES,
+            (const unsigned char*)associated_data.data(), associated_data.size(), nonce, key)
+        != 0) {
+        throw std::runtime_error("The ciphertext fails authentication!");
+    }
+    return plaintext_size;
+}
+
+std::string
+AeadCipher::encrypt(const std::string& ptext, const std::string& associated_data) const
+{
+    std::string ctext(sealed_size(ptext.size()), '\0');
+    memcpy(&ctext[AEAD_NONCE_BYTES], ptext.data(), ptext.size());
+    seal((unsigned char*)&ctext[0], ptext.size(), associated_data);
+    return ctext;
+}
+
+std::string
+AeadCipher::decrypt(const std::string& ctext, const std::string& associated_data) const
+{
+    if (ctext.size() < AEAD_OVERHEAD) {
+        throw std::runtime_error("The ciphertext is shorter than the nonce and the tag!");
+    }
+
+    /* Decrypt straight into the result rather than in place on a copy. */
+    const unsigned char* const nonce = (const unsigned char*)ctext.data();
+    std::string ptext(ctext.size() - AEAD_OVERHEAD, '\0');
+    if (crypto_aead_xchacha20poly1305_ietf_decrypt((unsigned char*)&ptext[0], nullptr, nullptr,
+            nonce + AEAD_NONCE_BYTES, ctext.size() - AEAD_NONCE_BYTES,
+            (const unsigned char*)associated_data.data(), associated_data.size(), nonce, key)
+        != 0) {
+        throw std::runtime_error("The ciphertext fails authentication!");
+    }
+    return ptext;
+}
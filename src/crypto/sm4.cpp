@@ -15,6 +15,7 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -25,6 +26,10 @@
 #include <crypto/sm4.h>
 #include <crypto/base64.h>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 #ifndef GET_ULONG_BE
 #define GET_ULONG_BE(n, b, i)                                                                                                                             \
     {                                                                                                                                                     \
@@ -106,27 +111,6 @@ static unsigned char sm4Sbox(unsigned char inch)
     return retVal;
 }
 
-static unsigned long sm4Lt(unsigned long ka)
-{
-    unsigned long bb = 0;
-    unsigned long c = 0;
-    unsigned char a[4];
-    unsigned char b[4];
-    PUT_ULONG_BE(ka, a, 0)
-    b[0] = sm4Sbox(a[0]);
-    b[1] = sm4Sbox(a[1]);
-    b[2] = sm4Sbox(a[2]);
-    b[3] = sm4Sbox(a[3]);
-    GET_ULONG_BE(bb, b, 0)
-    c = bb ^ (ROTL(bb, 2)) ^ (ROTL(bb, 10)) ^ (ROTL(bb, 18)) ^ (ROTL(bb, 24));
-    return c;
-}
-
-static unsigned long sm4F(unsigned long x0, unsigned long x1, unsigned long x2, unsigned long x3, unsigned long rk)
-{
-    return (x0 ^ sm4Lt(x1 ^ x2 ^ x3 ^ rk));
-}
-
 static unsigned long sm4CalciRK(unsigned long ka)
 {
     unsigned long bb = 0;
@@ -163,29 +147,155 @@ static void sm4_setkey(unsigned long SK[32], unsigned char key[16])
     }
 }
 
-static void sm4_one_round(unsigned long sk[32],
-    unsigned char input[16],
-    unsigned char output[16])
+/* Linear transform L of the round function. */
+static uint32_t sm4L(uint32_t b)
 {
-    unsigned long i = 0;
-    unsigned long ulbuf[36];
-
-    memset(ulbuf, 0, sizeof(ulbuf));
-    GET_ULONG_BE(ulbuf[0], input, 0)
-    GET_ULONG_BE(ulbuf[1], input, 4)
-    GET_ULONG_BE(ulbuf[2], input, 8)
-    GET_ULONG_BE(ulbuf[3], input, 12)
-    while (i < 32) {
-        ulbuf[i + 4] = sm4F(ulbuf[i], ulbuf[i + 1], ulbuf[i + 2], ulbuf[i + 3], sk[i]);
-        // #ifdef _DEBUG
-        //        printf("rk(%02d) = 0x%08x,  X(%02d) = 0x%08x \n",i,sk[i], i, ulbuf[i+4] );
-        // #endif
-        i++;
+    return b ^ (ROTL(b, 2)) ^ (ROTL(b, 10)) ^ (ROTL(b, 18)) ^ (ROTL(b, 24));
+}
+
+/**
+ * Round tables: t[i][x] is L applied to Sbox(x) placed at byte i (big-endian) of a word,
+ * so that the round function is four lookups and three XORs.
+ */
+struct SM4Tables {
+    uint32_t t[4][256];
+
+    SM4Tables()
+    {
+        for (unsigned int x = 0; x < 256; x++) {
+            const uint32_t l = sm4L((uint32_t)sm4Sbox((unsigned char)x) << 24);
+            t[0][x] = l;
+            t[1][x] = ROTL(l, 24);
+            t[2][x] = ROTL(l, 16);
+            t[3][x] = ROTL(l, 8);
+        }
+    }
+};
+
+static const SM4Tables& sm4_get_tables()
+{
+    static const SM4Tables tables;
+    return tables;
+}
+
+#define SM4_T(t, x) ((t)[0][(x) >> 24] ^ (t)[1][((x) >> 16) & 0xFF] ^ (t)[2][((x) >> 8) & 0xFF] ^ (t)[3][(x)&0xFF])
+
+typedef void (*sm4_kernel)(const uint32_t rk[32], const unsigned char* input, unsigned char* output, size_t blocks);
+
+static void sm4_crypt_blocks_table(const uint32_t rk[32],
+    const unsigned char* input,
+    unsigned char* output,
+    size_t blocks)
+{
+    const uint32_t(*t)[256] = sm4_get_tables().t;
+    for (; blocks > 0; blocks--) {
+        uint32_t x0, x1, x2, x3;
+        GET_ULONG_BE(x0, input, 0)
+        GET_ULONG_BE(x1, input, 4)
+        GET_ULONG_BE(x2, input, 8)
+        GET_ULONG_BE(x3, input, 12)
+        for (unsigned int i = 0; i < 32; i += 4) {
+            x0 ^= SM4_T(t, x1 ^ x2 ^ x3 ^ rk[i]);
+            x1 ^= SM4_T(t, x2 ^ x3 ^ x0 ^ rk[i + 1]);
+            x2 ^= SM4_T(t, x3 ^ x0 ^ x1 ^ rk[i + 2]);
+            x3 ^= SM4_T(t, x0 ^ x1 ^ x2 ^ rk[i + 3]);
+        }
+        PUT_ULONG_BE(x3, output, 0)
+        PUT_ULONG_BE(x2, output, 4)
+        PUT_ULONG_BE(x1, output, 8)
+        PUT_ULONG_BE(x0, output, 12)
+        input += 16;
+        output += 16;
     }
-    PUT_ULONG_BE(ulbuf[35], output, 0);
-    PUT_ULONG_BE(ulbuf[34], output, 4);
-    PUT_ULONG_BE(ulbuf[33], output, 8);
-    PUT_ULONG_BE(ulbuf[32], output, 12);
+}
+
+#if defined(__x86_64__) && !defined(SM4_DISABLE_AVX2)
+#define SM4_HAVE_AVX2
+
+/*
+ * Transposes the 4x4 word matrices held in each 128-bit lane, i.e. turns two blocks per register
+ * into one word (of eight blocks) per register and back.
+ */
+#define SM4_TRANSPOSE_AVX2(a, b, c, d)                  \
+    {                                                   \
+        const __m256i t0 = _mm256_unpacklo_epi32(a, b); \
+        const __m256i t1 = _mm256_unpackhi_epi32(a, b); \
+        const __m256i t2 = _mm256_unpacklo_epi32(c, d); \
+        const __m256i t3 = _mm256_unpackhi_epi32(c, d); \
+        a = _mm256_unpacklo_epi64(t0, t2);              \
+        b = _mm256_unpackhi_epi64(t0, t2);              \
+        c = _mm256_unpacklo_epi64(t1, t3);              \
+        d = _mm256_unpackhi_epi64(t1, t3);              \
+    }
+
+/**
+ * Runs SM4_AVX2_LANES blocks through the rounds together, each table lookup being a gather.
+ * The remaining blocks go through the table kernel.
+ */
+__attribute__((target("avx2"))) static void sm4_crypt_blocks_avx2(const uint32_t rk[32],
+    const unsigned char* input,
+    unsigned char* output,
+    size_t blocks)
+{
+    const uint32_t(*t)[256] = sm4_get_tables().t;
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+
+    for (; blocks >= SM4_AVX2_LANES; blocks -= SM4_AVX2_LANES) {
+        __m256i x0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)input), bswap);
+        __m256i x1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(input + 32)), bswap);
+        __m256i x2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(input + 64)), bswap);
+        __m256i x3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(input + 96)), bswap);
+        SM4_TRANSPOSE_AVX2(x0, x1, x2, x3)
+
+        for (unsigned int i = 0; i < 32; i++) {
+            const __m256i k = _mm256_xor_si256(_mm256_xor_si256(x1, x2),
+                _mm256_xor_si256(x3, _mm256_set1_epi32((int)rk[i])));
+            __m256i r = _mm256_i32gather_epi32((const int*)t[0], _mm256_srli_epi32(k, 24), 4);
+            r = _mm256_xor_si256(r,
+                _mm256_i32gather_epi32((const int*)t[1], _mm256_and_si256(_mm256_srli_epi32(k, 16), mask), 4));
+            r = _mm256_xor_si256(r,
+                _mm256_i32gather_epi32((const int*)t[2], _mm256_and_si256(_mm256_srli_epi32(k, 8), mask), 4));
+            r = _mm256_xor_si256(r,
+                _mm256_i32gather_epi32((const int*)t[3], _mm256_and_si256(k, mask), 4));
+            r = _mm256_xor_si256(x0, r);
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            x3 = r;
+        }
+
+        /* The output words are in reverse order. */
+        SM4_TRANSPOSE_AVX2(x3, x2, x1, x0)
+        _mm256_storeu_si256((__m256i*)output, _mm256_shuffle_epi8(x3, bswap));
+        _mm256_storeu_si256((__m256i*)(output + 32), _mm256_shuffle_epi8(x2, bswap));
+        _mm256_storeu_si256((__m256i*)(output + 64), _mm256_shuffle_epi8(x1, bswap));
+        _mm256_storeu_si256((__m256i*)(output + 96), _mm256_shuffle_epi8(x0, bswap));
+        input += 16 * SM4_AVX2_LANES;
+        output += 16 * SM4_AVX2_LANES;
+    }
+
+    sm4_crypt_blocks_table(rk, input, output, blocks);
+}
+#endif
+
+static sm4_kernel sm4_select_kernel()
+{
+#ifdef SM4_HAVE_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return sm4_crypt_blocks_avx2;
+    }
+#endif
+    return sm4_crypt_blocks_table;
+}
+
+/* Picked once, on first use. */
+static sm4_kernel sm4_get_kernel()
+{
+    static const sm4_kernel kernel = sm4_select_kernel();
+    return kernel;
 }
 
 /*unsigned char*
@@ -223,12 +333,15 @@ void sm4_crypt_ecb(sm4_context* ctx,
     unsigned char* input,
     unsigned char* output)
 {
-    while (length > 0) {
-        sm4_one_round(ctx->sk, input, output);
-        input += 16;
-        output += 16;
-        length -= 16;
+    if (length <= 0) {
+        return;
     }
+
+    uint32_t rk[32];
+    for (unsigned int i = 0; i < 32; i++) {
+        rk[i] = (uint32_t)ctx->sk[i];
+    }
+    sm4_get_kernel()(rk, input, output, getBlocks(AES_BLOCK_BYTES, (size_t)length));
 }
 
 static std::vector<unsigned char>
@@ -272,25 +385,113 @@ unpad(std::vector<unsigned char> data)
     return res;
 }
 
+SM4Cipher::SM4Cipher(const std::string& raw_key)
+{
+    unsigned char key[16] = { 0 };
+    memcpy(key, raw_key.data(), std::min(raw_key.size(), sizeof(key)));
+
+    unsigned long sk[32];
+    sm4_setkey(sk, key);
+    for (unsigned int i = 0; i < 32; i++) {
+        rk_enc[i] = (uint32_t)sk[i];
+        rk_dec[i] = (uint32_t)sk[31 - i];
+    }
+}
+
+void SM4Cipher::encrypt_blocks(const unsigned char* input, unsigned char* output, const size_t& blocks) const
+{
+    sm4_get_kernel()(rk_enc, input, output, blocks);
+}
+
+void SM4Cipher::decrypt_blocks(const unsigned char* input, unsigned char* output, const size_t& blocks) const
+{
+    sm4_get_kernel()(rk_dec, input, output, blocks);
+}
+
+std::string
+SM4Cipher::encrypt(const std::string& ptext) const
+{
+    auto buf = pad(std::vector<unsigned char>(ptext.begin(), ptext.end()), AES_BLOCK_BYTES);
+    encrypt_blocks(&buf[0], &buf[0], buf.size() / AES_BLOCK_BYTES);
+    return base64_encode(std::string((char*)&buf[0], buf.size()));
+}
+
+std::string
+SM4Cipher::decrypt(const std::string& ctext) const
+{
+    const std::string ciphertext = base64_decode(ctext);
+    if (ciphertext.empty() || ciphertext.size() % AES_BLOCK_BYTES != 0) {
+        throw std::runtime_error("SM4 ciphertext is not a whole number of blocks!");
+    }
+
+    std::vector<unsigned char> buf(ciphertext.begin(), ciphertext.end());
+    decrypt_blocks(&buf[0], &buf[0], buf.size() / AES_BLOCK_BYTES);
+    auto res = unpad(buf);
+    return std::string((char*)res.data(), res.size());
+}
+
+std::vector<std::string>
+SM4Cipher::encrypt(const std::vector<std::string>& ptexts) const
+{
+    /* Pad every buffer in place, back to back, and encrypt them all in one go. */
+    std::vector<size_t> offsets(ptexts.size() + 1, 0);
+    for (size_t i = 0; i < ptexts.size(); i++) {
+        offsets[i + 1] = offsets[i] + (ptexts[i].size() / AES_BLOCK_BYTES + 1) * AES_BLOCK_BYTES;
+    }
+    std::vector<unsigned char> buf(offsets.back(), 0);
+    for (size_t i = 0; i < ptexts.size(); i++) {
+        memcpy(&buf[offsets[i]], ptexts[i].data(), ptexts[i].size());
+        buf[offsets[i + 1] - 1] = (unsigned char)(offsets[i + 1] - offsets[i] - ptexts[i].size());
+    }
+    encrypt_blocks(buf.data(), buf.data(), buf.size() / AES_BLOCK_BYTES);
+
+    std::vector<std::string> ctexts;
+    ctexts.reserve(ptexts.size());
+    for (size_t i = 0; i < ptexts.size(); i++) {
+        ctexts.push_back(base64_encode(std::string((char*)&buf[offsets[i]], offsets[i + 1] - offsets[i])));
+    }
+    return ctexts;
+}
+
+std::vector<std::string>
+SM4Cipher::decrypt(const std::vector<std::string>& ctexts) const
+{
+    std::vector<std::string> ciphertexts;
+    ciphertexts.reserve(ctexts.size());
+    std::vector<size_t> offsets(1, 0);
+    for (const std::string& ctext : ctexts) {
+        ciphertexts.push_back(base64_decode(ctext));
+        if (ciphertexts.back().empty() || ciphertexts.back().size() % AES_BLOCK_BYTES != 0) {
+            throw std::runtime_error("SM4 ciphertext is not a whole number of blocks!");
+        }
+        offsets.push_back(offsets.back() + ciphertexts.back().size());
+    }
+    std::vector<unsigned char> buf(offsets.back());
+    for (size_t i = 0; i < ciphertexts.size(); i++) {
+        memcpy(&buf[offsets[i]], ciphertexts[i].data(), ciphertexts[i].size());
+    }
+    decrypt_blocks(buf.data(), buf.data(), buf.size() / AES_BLOCK_BYTES);
+
+    std::vector<std::string> ptexts;
+    ptexts.reserve(ctexts.size());
+    for (size_t i = 0; i < ciphertexts.size(); i++) {
+        const size_t pad_count = buf[offsets[i + 1] - 1];
+        if (false == ((pad_count > 0) && (pad_count <= AES_BLOCK_BYTES))) {
+            throw std::runtime_error("AES padding is wrong size!");
+        }
+        ptexts.emplace_back((char*)&buf[offsets[i]], offsets[i + 1] - offsets[i] - pad_count);
+    }
+    return ptexts;
+}
+
 std::string
 encrypt_SM4_EBC(const std::string& ptext, const std::string& raw_key)
 {
-    sm4_context ctx;
-    auto ptext_buf = pad(std::vector<unsigned char>(ptext.begin(), ptext.end()), AES_BLOCK_BYTES);
-    std::vector<unsigned char> ctext_buf(ptext_buf.size());
-    sm4_setkey_enc(&ctx, (unsigned char*)raw_key.c_str());
-    sm4_crypt_ecb(&ctx, 1, ptext_buf.size(), &ptext_buf[0], &ctext_buf[0]);
-    return base64_encode(std::string((char*)&ctext_buf[0], ctext_buf.size()));
+    return SM4Cipher(raw_key).encrypt(ptext);
 }
 
 std::string
 decrypt_SM4_EBC(const std::string& ctext, const std::string& raw_key)
 {
-    const std::string ciphertext = base64_decode(ctext);
-    sm4_context ctx;
-    std::vector<unsigned char> ptext_buf(ciphertext.size());
-    sm4_setkey_dec(&ctx, (unsigned char*)raw_key.c_str());
-    sm4_crypt_ecb(&ctx, 0, ciphertext.size(), (unsigned char*)ciphertext.data(), &ptext_buf[0]);
-    auto res = unpad(ptext_buf);
-    return std::string((char*)&res[0], res.size());
+    return SM4Cipher(raw_key).decrypt(ctext);
 }
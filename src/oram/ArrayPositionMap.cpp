@@ -0,0 +1,62 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/ArrayPositionMap.h>
+
+#include <stdexcept>
+#include <string>
+
+ArrayPositionMap::ArrayPositionMap(const unsigned int& num_blocks, RandForOramInterface* rand_gen)
+    : leaves(num_blocks)
+{
+    for (unsigned int i = 0; i < num_blocks; i++) {
+        leaves[i] = rand_gen->getRandomLeaf();
+    }
+}
+
+void ArrayPositionMap::check_bound(const unsigned int& block_index)
+{
+    if (block_index >= leaves.size()) {
+        throw std::runtime_error(
+            "You are trying to access Block " + std::to_string(block_index) + ", but this ORAM contains only " + std::to_string(leaves.size()) + " blocks.");
+    }
+}
+
+unsigned int ArrayPositionMap::get(const unsigned int& block_index)
+{
+    check_bound(block_index);
+    return leaves[block_index];
+}
+
+void ArrayPositionMap::set(const unsigned int& block_index, const unsigned int& leaf)
+{
+    check_bound(block_index);
+    leaves[block_index] = leaf;
+}
+
+unsigned int ArrayPositionMap::exchange(const unsigned int& block_index, const unsigned int& leaf)
+{
+    check_bound(block_index);
+    const unsigned int old_leaf = leaves[block_index];
+    leaves[block_index] = leaf;
+    return old_leaf;
+}
+
+unsigned int ArrayPositionMap::size()
+{
+    return leaves.size();
+}
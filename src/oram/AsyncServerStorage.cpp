@@ -0,0 +1,525 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/AsyncServerStorage.h>
+#include <plog/Log.h>
+#include <utils.h>
+
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+template <typename Response, typename Result>
+struct AsyncServerStorage::ResponseCall : public AsyncServerStorage::Call {
+    Response response;
+
+    std::unique_ptr<grpc::ClientAsyncResponseReader<Response>> reader;
+
+    std::promise<Result> promise;
+
+    std::function<Result(Response&)> parse;
+
+    void complete(const bool& ok) override
+    {
+        if (!ok || !status.ok()) {
+            const std::string message = ok ? status.error_message() : "The request was cancelled.";
+            promise.set_exception(std::make_exception_ptr(std::runtime_error(message)));
+            return;
+        }
+
+        try {
+            if constexpr (std::is_void<Result>::value) {
+                promise.set_value();
+            } else {
+                promise.set_value(parse(response));
+            }
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+};
+
+/**
+ * @brief Get a future that already holds the value, for a read served from the pending writes alone.
+ */
+template <typename Result>
+static std::future<Result> ready_future(Result value)
+{
+    std::promise<Result> promise;
+    promise.set_value(std::move(value));
+    return promise.get_future();
+}
+
+AsyncServerStorage::AsyncServerStorage(
+    const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub* stub_,
+    const size_t& window)
+    : control(oram_id, is_odict, key, stub_)
+    , stub_(stub_)
+    , handle(0)
+    , window(window)
+    , capacity(0)
+    , num_levels(0)
+    , block_size(0)
+    , in_flight(0)
+{
+    if (window == 0) {
+        throw std::runtime_error("The window of an asynchronous server storage must hold at least one request.");
+    }
+
+    completion_thread = std::thread(&AsyncServerStorage::complete_calls, this);
+    PLOG(plog::info) << "The asynchronous server storage interface class is initialized.";
+}
+
+AsyncServerStorage::~AsyncServerStorage()
+{
+    try {
+        flush();
+    } catch (const std::exception& e) {
+        PLOG(plog::error) << e.what();
+    }
+
+    cq.Shutdown();
+    completion_thread.join();
+}
+
+void AsyncServerStorage::setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size)
+{
+    flush();
+
+    control.setCapacity(total_number_of_buckets, slots_per_bucket, block_size);
+    handle = control.get_handle();
+    capacity = total_number_of_buckets;
+    num_levels = get_num_levels(total_number_of_buckets);
+    this->block_size = block_size;
+}
+
+void AsyncServerStorage::check_position(const int& position)
+{
+    if (position >= this->capacity || position < 0) {
+        throw std::runtime_error(
+            "You are trying to access Bucket " + std::to_string(position) + ", but this Server contains only " + std::to_string(this->capacity) + " buckets.");
+    }
+}
+
+void AsyncServerStorage::check_path(const int& leaf, const int& start_level)
+{
+    if (leaf >= (1 << (num_levels - 1)) || leaf < 0) {
+        throw std::runtime_error(
+            "You are trying to access leaf " + std::to_string(leaf) + ", but this Server contains only " + std::to_string(1 << (num_levels - 1)) + " leaves.");
+    }
+    if (start_level < 0 || start_level > num_levels) {
+        throw std::runtime_error(
+            "You are trying to start from level " + std::to_string(start_level) + ", but this Server contains only " + std::to_string(num_levels) + " levels.");
+    }
+}
+
+void AsyncServerStorage::complete_calls()
+{
+    void* tag;
+    bool ok;
+    while (cq.Next(&tag, &ok)) {
+        std::unique_ptr<Call> call(static_cast<Call*>(tag));
+
+        // Release the buckets before the future is ready, so that whoever waits on it may access them at once.
+        {
+            std::lock_guard<std::mutex> lock(call_lock);
+            for (const int& position : call->reads) {
+                if (--reading[position] == 0) {
+                    reading.erase(position);
+                }
+            }
+            for (const int& position : call->writes) {
+                pending_buckets.erase(position);
+            }
+            in_flight--;
+        }
+        call_done.notify_all();
+
+        call->complete(ok);
+    }
+}
+
+template <typename Response, typename Result>
+std::future<Result> AsyncServerStorage::issue(
+    const std::function<std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>(grpc::ClientContext*)>& start,
+    const std::vector<int>& reads, const std::vector<int>& writes, const std::vector<Bucket>& buckets_to_write,
+    const std::function<Result(Response&)>& parse)
+{
+    ResponseCall<Response, Result>* call = new ResponseCall<Response, Result>();
+    call->reads = reads;
+    call->writes = writes;
+    call->parse = parse;
+
+    for (const int& position : reads) {
+        reading[position]++;
+    }
+    for (size_t i = 0; i < writes.size(); i++) {
+        pending_buckets[writes[i]] = buckets_to_write[i];
+    }
+    in_flight++;
+
+    std::future<Result> future = call->promise.get_future();
+    call->reader = start(&call->context);
+    call->reader->Finish(&call->response, &call->status, call);
+    return future;
+}
+
+bool AsyncServerStorage::can_write(const std::vector<int>& positions)
+{
+    for (const int& position : positions) {
+        if (pending_buckets.find(position) != pending_buckets.end() || reading.find(position) != reading.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int AsyncServerStorage::pending_prefix(const int& leaf, const int& start_level)
+{
+    int prefix = 0;
+    while (start_level + prefix < num_levels
+        && pending_buckets.find(get_bucket_position(leaf, start_level + prefix, num_levels)) != pending_buckets.end()) {
+        prefix++;
+    }
+    for (int l = start_level + prefix; l < num_levels; l++) {
+        if (pending_buckets.find(get_bucket_position(leaf, l, num_levels)) != pending_buckets.end()) {
+            return -1;
+        }
+    }
+    return prefix;
+}
+
+std::future<Bucket> AsyncServerStorage::ReadBucketAsync(const int& position)
+{
+    check_writes();
+    check_position(position);
+
+    BucketReadMessage message;
+    message.set_position(position);
+    message.set_handle(handle);
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    call_done.wait(lock, [this] { return in_flight < window; });
+
+    auto iter = pending_buckets.find(position);
+    if (iter != pending_buckets.end()) {
+        return ready_future(iter->second);
+    }
+
+    const int block_size = this->block_size;
+    return issue<BucketReadResponse, Bucket>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncread_bucket(context, message, &cq); },
+        { position }, {}, {},
+        [block_size](BucketReadResponse& response) { return Bucket(std::move(*response.mutable_buffer()), block_size); });
+}
+
+std::future<void> AsyncServerStorage::WriteBucketAsync(const int& position, const Bucket& bucket_to_write)
+{
+    check_writes();
+    check_position(position);
+
+    BucketWriteMessage message;
+    message.set_position(position);
+    message.set_buffer(bucket_to_write.getBuffer());
+    message.set_handle(handle);
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    call_done.wait(lock, [this, &position] { return in_flight < window && can_write({ position }); });
+
+    return issue<google::protobuf::Empty, void>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncwrite_bucket(context, message, &cq); },
+        {}, { position }, { bucket_to_write }, nullptr);
+}
+
+std::future<std::vector<Bucket>> AsyncServerStorage::ReadPathAsync(const int& leaf, const int& start_level)
+{
+    check_writes();
+    check_path(leaf, start_level);
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    int prefix = 0;
+    call_done.wait(lock, [&] { return in_flight < window && (prefix = pending_prefix(leaf, start_level)) >= 0; });
+
+    std::vector<Bucket> buckets;
+    buckets.reserve(num_levels - start_level);
+    const int remote_level = start_level + prefix;
+    for (int l = start_level; l < remote_level; l++) {
+        buckets.push_back(pending_buckets.at(get_bucket_position(leaf, l, num_levels)));
+    }
+    if (remote_level == num_levels) {
+        return ready_future(std::move(buckets));
+    }
+
+    PathReadMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(remote_level);
+    message.set_handle(handle);
+
+    std::vector<int> positions;
+    for (int l = remote_level; l < num_levels; l++) {
+        positions.push_back(get_bucket_position(leaf, l, num_levels));
+    }
+
+    const int requested = num_levels - remote_level;
+    const int block_size = this->block_size;
+    return issue<PathReadResponse, std::vector<Bucket>>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncread_path(context, message, &cq); },
+        positions, {}, {},
+        [buckets, requested, block_size](PathReadResponse& response) {
+            if (response.buckets_size() != requested) {
+                throw std::runtime_error("The server returned a path of " + std::to_string(response.buckets_size()) + " buckets, but " + std::to_string(requested) + " were requested.");
+            }
+
+            std::vector<Bucket> path = buckets;
+            for (int i = 0; i < response.buckets_size(); i++) {
+                path.emplace_back(std::move(*response.mutable_buckets(i)), block_size);
+            }
+            return path;
+        });
+}
+
+std::future<void> AsyncServerStorage::WritePathAsync(
+    const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+{
+    check_writes();
+    check_path(leaf, start_level);
+
+    PathWriteMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(start_level);
+    message.set_handle(handle);
+    std::vector<int> positions;
+    for (size_t i = 0; i < buckets_to_write.size() && start_level + (int)i < num_levels; i++) {
+        message.add_buckets(buckets_to_write[i].getBuffer());
+        positions.push_back(get_bucket_position(leaf, start_level + i, num_levels));
+    }
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    call_done.wait(lock, [this, &positions] { return in_flight < window && can_write(positions); });
+
+    return issue<google::protobuf::Empty, void>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncwrite_path(context, message, &cq); },
+        {}, positions, buckets_to_write, nullptr);
+}
+
+std::future<std::vector<Block>> AsyncServerStorage::ReadBlocksAsync(
+    const int& leaf, const std::vector<int>& offsets, const int& start_level)
+{
+    check_writes();
+    check_path(leaf, start_level);
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    int prefix = 0;
+    call_done.wait(lock, [&] { return in_flight < window && (prefix = pending_prefix(leaf, start_level)) >= 0; });
+
+    std::vector<Block> blocks;
+    blocks.reserve(offsets.size());
+    const int remote_level = start_level + prefix;
+    for (int l = start_level; l < remote_level && l - start_level < (int)offsets.size(); l++) {
+        blocks.push_back(pending_buckets.at(get_bucket_position(leaf, l, num_levels)).getBlockAt(offsets[l - start_level]));
+    }
+    if (remote_level == num_levels) {
+        return ready_future(std::move(blocks));
+    }
+
+    PathBlocksReadMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(remote_level);
+    message.set_handle(handle);
+    std::vector<int> positions;
+    for (size_t i = remote_level - start_level; i < offsets.size(); i++) {
+        message.add_offsets(offsets[i]);
+        positions.push_back(get_bucket_position(leaf, start_level + i, num_levels));
+    }
+
+    const int requested = message.offsets_size();
+    const int block_size = this->block_size;
+    return issue<PathBlocksReadResponse, std::vector<Block>>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncread_path_blocks(context, message, &cq); },
+        positions, {}, {},
+        [blocks, requested, block_size](PathBlocksReadResponse& response) {
+            if (response.blocks_size() != requested) {
+                throw std::runtime_error("The server returned " + std::to_string(response.blocks_size()) + " blocks, but " + std::to_string(requested) + " were requested.");
+            }
+
+            std::vector<Block> path = blocks;
+            for (int i = 0; i < response.blocks_size(); i++) {
+                const std::string& slot = response.blocks(i);
+                if (slot.size() != Block::slot_size(block_size)) {
+                    throw std::runtime_error("The server returned a slot of " + std::to_string(slot.size()) + " bytes.");
+                }
+                path.push_back(Block::read_slot(slot.data(), block_size));
+            }
+            return path;
+        });
+}
+
+std::future<std::vector<Bucket>> AsyncServerStorage::ReadBucketsAsync(const std::vector<int>& positions)
+{
+    check_writes();
+    for (const int& position : positions) {
+        check_position(position);
+    }
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    call_done.wait(lock, [this] { return in_flight < window; });
+
+    // Buckets that are still being written are served from the pending writes, the others from the server.
+    BucketsReadMessage message;
+    message.set_handle(handle);
+    std::vector<int> remote_positions;
+    std::vector<Bucket> buckets(positions.size());
+    std::vector<bool> is_local(positions.size(), false);
+    for (size_t i = 0; i < positions.size(); i++) {
+        auto iter = pending_buckets.find(positions[i]);
+        if (iter != pending_buckets.end()) {
+            buckets[i] = iter->second;
+            is_local[i] = true;
+        } else {
+            message.add_positions(positions[i]);
+            remote_positions.push_back(positions[i]);
+        }
+    }
+    if (remote_positions.empty()) {
+        return ready_future(std::move(buckets));
+    }
+
+    const int block_size = this->block_size;
+    return issue<BucketsReadResponse, std::vector<Bucket>>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncread_buckets(context, message, &cq); },
+        remote_positions, {}, {},
+        [buckets, is_local, block_size](BucketsReadResponse& response) {
+            std::vector<Bucket> result = buckets;
+            int next = 0;
+            for (size_t i = 0; i < result.size(); i++) {
+                if (is_local[i]) {
+                    continue;
+                }
+                if (next == response.buckets_size()) {
+                    throw std::runtime_error("The server returned " + std::to_string(response.buckets_size()) + " buckets, which is too few.");
+                }
+                result[i] = Bucket(std::move(*response.mutable_buckets(next++)), block_size);
+            }
+            return result;
+        });
+}
+
+std::future<void> AsyncServerStorage::WriteBucketsAsync(
+    const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    check_writes();
+    if (positions.size() != buckets_to_write.size()) {
+        throw std::runtime_error("The number of buckets does not match the number of positions.");
+    }
+
+    BucketsWriteMessage message;
+    message.set_handle(handle);
+    for (size_t i = 0; i < positions.size(); i++) {
+        check_position(positions[i]);
+        message.add_positions(positions[i]);
+        message.add_buckets(buckets_to_write[i].getBuffer());
+    }
+
+    std::unique_lock<std::mutex> lock(call_lock);
+    call_done.wait(lock, [this, &positions] { return in_flight < window && can_write(positions); });
+
+    return issue<google::protobuf::Empty, void>(
+        [this, &message](grpc::ClientContext* context) { return stub_->Asyncwrite_buckets(context, message, &cq); },
+        {}, positions, buckets_to_write, nullptr);
+}
+
+Bucket AsyncServerStorage::ReadBucket(const int& position)
+{
+    return ReadBucketAsync(position).get();
+}
+
+void AsyncServerStorage::WriteBucket(const int& position, const Bucket& bucket_to_write)
+{
+    detach(WriteBucketAsync(position, bucket_to_write));
+}
+
+std::vector<Bucket> AsyncServerStorage::ReadPath(const int& leaf, const int& start_level)
+{
+    return ReadPathAsync(leaf, start_level).get();
+}
+
+void AsyncServerStorage::WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+{
+    detach(WritePathAsync(leaf, buckets_to_write, start_level));
+}
+
+std::vector<Block> AsyncServerStorage::ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level)
+{
+    return ReadBlocksAsync(leaf, offsets, start_level).get();
+}
+
+std::vector<Bucket> AsyncServerStorage::ReadBuckets(const std::vector<int>& positions)
+{
+    return ReadBucketsAsync(positions).get();
+}
+
+void AsyncServerStorage::WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    detach(WriteBucketsAsync(positions, buckets_to_write));
+}
+
+void AsyncServerStorage::LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write)
+{
+    flush();
+    control.LoadBuckets(first_position, buckets_to_write);
+}
+
+void AsyncServerStorage::detach(std::future<void> write)
+{
+    std::lock_guard<std::mutex> lock(call_lock);
+    detached_writes.push_back(std::move(write));
+}
+
+void AsyncServerStorage::check_writes()
+{
+    std::list<std::future<void>> completed;
+    {
+        std::lock_guard<std::mutex> lock(call_lock);
+        for (auto iter = detached_writes.begin(); iter != detached_writes.end();) {
+            auto next = std::next(iter);
+            if (iter->wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                completed.splice(completed.end(), detached_writes, iter);
+            }
+            iter = next;
+        }
+    }
+
+    for (std::future<void>& future : completed) {
+        future.get();
+    }
+}
+
+void AsyncServerStorage::flush()
+{
+    std::list<std::future<void>> writes;
+    {
+        std::unique_lock<std::mutex> lock(call_lock);
+        call_done.wait(lock, [this] { return in_flight == 0; });
+        writes.swap(detached_writes);
+    }
+
+    for (std::future<void>& future : writes) {
+        future.get();
+    }
+}
@@ -17,9 +17,12 @@
 
 #include <oram/Block.h>
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+
 Block::Block(const Block& block)
 {
     index = block.index;
@@ -27,6 +30,13 @@ Block::Block(const Block& block)
     data = block.data;
 }
 
+Block::Block(Block&& block) noexcept
+    : leaf_id(block.leaf_id)
+    , index(block.index)
+    , data(std::move(block.data))
+{
+}
+
 Block::Block(
     const int& leaf_id,
     const int& index,
@@ -55,4 +65,39 @@ void Block::printBlock()
                   << " leaf id: " << std::to_string(leaf_id) << " data: " << data
                   << std::endl;
     }
-}
\ No newline at end of file
+}
+
+size_t Block::slot_size(const size_t& block_size)
+{
+    return sizeof(SlotHeader) + block_size;
+}
+
+void Block::write_slot(char* slot, const size_t& block_size) const
+{
+    if (data.size() > block_size) {
+        throw std::length_error(
+            "Block " + std::to_string(index) + " holds " + std::to_string(data.size()) + " bytes, but a slot holds only " + std::to_string(block_size) + " bytes.");
+    }
+
+    const SlotHeader header = { leaf_id, index, (uint32_t)data.size() };
+    memcpy(slot, &header, sizeof(SlotHeader));
+    memcpy(slot + sizeof(SlotHeader), data.data(), data.size());
+    memset(slot + sizeof(SlotHeader) + data.size(), 0, block_size - data.size());
+}
+
+Block Block::read_slot(const char* slot, const size_t& block_size)
+{
+    const SlotHeader header = read_header(slot);
+    if (header.length > block_size) {
+        throw std::length_error("The slot claims more data than its payload holds.");
+    }
+
+    return Block(header.leaf_id, header.index, std::string(slot + sizeof(SlotHeader), header.length));
+}
+
+SlotHeader Block::read_header(const char* slot)
+{
+    SlotHeader header;
+    memcpy(&header, slot, sizeof(SlotHeader));
+    return header;
+}
@@ -0,0 +1,39 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/BoundedRandomForOram.h>
+
+#include <random>
+#include <stdexcept>
+
+BoundedRandomForOram::BoundedRandomForOram()
+    : bound(-1)
+{
+}
+
+int BoundedRandomForOram::getRandomLeaf()
+{
+    if (bound <= 0) {
+        throw std::runtime_error("The bound of the random leaf is not set.");
+    }
+    return std::uniform_int_distribution<int>(0, bound - 1)(rng);
+}
+
+void BoundedRandomForOram::setBound(int num_leaves)
+{
+    bound = num_leaves;
+}
@@ -21,89 +21,99 @@
 #include <sstream>
 #include <string>
 
-bool Bucket::is_init = false;
-int Bucket::max_size = -1;
-
 Bucket::Bucket()
+    : block_size(0)
 {
 }
 
-//Copy constructor
-Bucket::Bucket(Bucket* other)
+Bucket::Bucket(const size_t& num_slots, const size_t& block_size)
+    : buffer(num_slots * Block::slot_size(block_size), '\0')
+    , block_size(block_size)
 {
-    if (other == NULL) {
-        std::cout << "triggered by me? NULL check\n";
-        throw std::runtime_error("the other bucket is not malloced.");
-    }
-    blocks = std::vector<Block>(max_size);
-    for (int i = 0; i < max_size; i++) {
-        blocks[i] = Block(other->blocks[i]);
+    const Block dummy;
+    for (size_t i = 0; i < num_slots; i++) {
+        dummy.write_slot(&buffer[i * Block::slot_size(block_size)], block_size);
     }
 }
 
-//Get block object with matching index
-Block Bucket::getBlockByIndex(int index)
+Bucket::Bucket(const vector<Block>& blocks, const size_t& block_size)
+    : buffer(blocks.size() * Block::slot_size(block_size), '\0')
+    , block_size(block_size)
 {
-    Block* copy_block = NULL;
-    for (Block b : blocks) {
-        if (b.index == index) {
-            copy_block = new Block(b);
-            break;
-        }
+    for (size_t i = 0; i < blocks.size(); i++) {
+        blocks[i].write_slot(&buffer[i * Block::slot_size(block_size)], block_size);
     }
-    return *copy_block;
 }
 
-void Bucket::addBlock(Block new_blk)
+Bucket::Bucket(std::string&& buffer, const size_t& block_size)
+    : buffer(std::move(buffer))
+    , block_size(block_size)
 {
-    if (blocks.size() < (unsigned)max_size) {
-        Block toAdd = Block(new_blk);
-        blocks.push_back(toAdd);
+    if (this->buffer.size() % Block::slot_size(block_size) != 0) {
+        throw std::length_error("The bucket is not a whole number of slots.");
     }
 }
 
-bool Bucket::removeBlock(Block rm_blk)
+size_t Bucket::size() const
+{
+    return buffer.empty() ? 0 : buffer.size() / Block::slot_size(block_size);
+}
+
+size_t Bucket::getBlockSize() const
+{
+    return block_size;
+}
+
+void Bucket::check_offset(const int& offset) const
 {
-    bool removed = false;
-    for (unsigned int i = 0; i < blocks.size(); i++) {
-        if (blocks[i].index == rm_blk.index) {
-            blocks.erase(blocks.begin() + i);
-            removed = true;
-            break;
-        }
+    if (offset < 0 || (size_t)offset >= size()) {
+        throw std::out_of_range("the slot " + std::to_string(offset) + " is not in the bucket.");
     }
-    return removed;
 }
 
-// Return a shallow copy.
-vector<Block> Bucket::getBlocks()
+SlotHeader Bucket::getHeaderAt(int offset) const
+{
+    check_offset(offset);
+    return Block::read_header(&buffer[offset * Block::slot_size(block_size)]);
+}
+
+Block Bucket::getBlockAt(int offset) const
+{
+    check_offset(offset);
+    return Block::read_slot(&buffer[offset * Block::slot_size(block_size)], block_size);
+}
+
+void Bucket::setBlockAt(int offset, const Block& block)
 {
-    return this->blocks;
+    check_offset(offset);
+    block.write_slot(&buffer[offset * Block::slot_size(block_size)], block_size);
 }
 
-void Bucket::setMaxSize(int maximumSize)
+vector<Block> Bucket::getBlocks() const
 {
-    // For convenience, we can re-init it.
-    if (is_init == true && maximumSize != max_size) {
-        throw std::runtime_error("Max Bucket Size was already set");
+    vector<Block> blocks;
+    blocks.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        blocks.push_back(getBlockAt(i));
     }
-    max_size = maximumSize;
-    is_init = true;
+    return blocks;
 }
 
-int Bucket::getMaxSize()
+vector<Block> Bucket::takeBlocks()
 {
-    return max_size;
+    vector<Block> blocks = getBlocks();
+    buffer.clear();
+    return blocks;
 }
 
-void Bucket::resetState()
+const std::string& Bucket::getBuffer() const
 {
-    is_init = false;
+    return buffer;
 }
 
 void Bucket::printBlocks()
 {
-    for (Block b : blocks) {
+    for (Block b : getBlocks()) {
         b.printBlock();
     }
 }
@@ -0,0 +1,348 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/ArrayPositionMap.h>
+#include <oram/CircuitOram.h>
+#include <utils.h>
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+CircuitOram::CircuitOram(
+    UntrustedStorageInterface* storage,
+    RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+    const unsigned int& num_blocks, const unsigned int& block_size,
+    PositionMapInterface* position_map,
+    const unsigned int& stash_limit)
+    : CircuitOram(
+        storage, rand_gen, bucket_size, num_blocks,
+        std::vector<std::pair<unsigned int, std::string>>(), block_size, position_map, stash_limit)
+{
+}
+
+CircuitOram::CircuitOram(
+    UntrustedStorageInterface* storage,
+    RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+    const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+    const unsigned int& block_size, PositionMapInterface* position_map,
+    const unsigned int& stash_limit)
+{
+    this->storage = storage;
+    this->rand_gen = rand_gen;
+    this->bucket_size = bucket_size;
+    this->block_size = block_size;
+    this->stash_limit = stash_limit;
+    this->num_blocks = num_blocks;
+    this->num_levels = std::ceil(log10(num_blocks) / log10(2)) + 1;
+    this->num_buckets = (unsigned int)std::pow(2, num_levels) - 1;
+    this->eviction_counter = 0;
+
+    if (this->num_buckets * this->bucket_size < this->num_blocks) //deal with precision loss
+    {
+        throw std::runtime_error("Not enough space for the acutal number of blocks.");
+    }
+
+    this->num_leaves = (unsigned int)std::pow(2, num_levels - 1);
+    this->rand_gen->setBound(num_leaves);
+    this->storage->setCapacity(num_buckets, bucket_size, block_size);
+    this->position_map = position_map != nullptr ? position_map : new ArrayPositionMap(num_blocks, rand_gen);
+    if (this->position_map->size() < num_blocks) {
+        throw std::runtime_error("The position map does not cover every block.");
+    }
+
+    std::vector<std::pair<unsigned int, unsigned int>> leaves;
+    leaves.reserve(blocks.size());
+    for (const auto& block : blocks) {
+        if (stash.find(block.first) != nullptr) {
+            throw std::runtime_error("Block " + std::to_string(block.first) + " is loaded more than once.");
+        }
+        check_data_size(block.second);
+        const int leaf = rand_gen->getRandomLeaf();
+        leaves.emplace_back(block.first, leaf);
+        stash.add(Block(leaf, block.first, block.second));
+    }
+    this->position_map->load(leaves);
+
+    std::vector<int> positions(num_buckets);
+    std::iota(positions.begin(), positions.end(), 0);
+    storage->LoadBuckets(0, stash.evict_buckets(positions, num_levels, bucket_size, block_size));
+    if (stash.size() > stash_limit) {
+        throw std::runtime_error("The dataset does not fit in the ORAM tree.");
+    }
+}
+
+CircuitOram::~CircuitOram()
+{
+    delete position_map;
+}
+
+std::string
+CircuitOram::access_handler(
+    Operation op, const unsigned int& blockIndex,
+    const int& oldLeaf, const int& newLeaf, const std::string& new_data)
+{
+    std::string data; // The data to be returned.
+
+    read_and_remove(oldLeaf, blockIndex);
+
+    Block* block = stash.find(blockIndex);
+    if (block != nullptr) {
+        block->leaf_id = newLeaf;
+    }
+
+    if (op == Operation::WRITE) {
+        if (block == nullptr) {
+            stash.add(Block(newLeaf, blockIndex, new_data));
+        } else {
+            block->data = new_data;
+        }
+    } else {
+        if (block != nullptr) {
+            data = block->data;
+        }
+    }
+
+    evict_once();
+    evict_once();
+
+    if (stash.size() > stash_limit) {
+        throw std::runtime_error("Circuit ORAM stash overflow: " + std::to_string(stash.size()) + " blocks.");
+    }
+
+    return data;
+}
+
+void CircuitOram::read_and_remove(const int& leaf, const unsigned int& blockIndex)
+{
+    std::vector<Bucket> path = storage->ReadPath(leaf);
+
+    for (unsigned int l = 0; l < num_levels; l++) {
+        std::vector<Block> blocks = path.at(l).takeBlocks();
+        bool found = false;
+        for (Block& block : blocks) {
+            if (block.index == (int)blockIndex) {
+                stash.add(std::move(block));
+                block = Block(); //dummy block
+                found = true;
+                break;
+            }
+        }
+        path[l] = Bucket(blocks, block_size);
+        if (found) {
+            break;
+        }
+    }
+
+    storage->WritePath(leaf, path);
+}
+
+void CircuitOram::evict_once()
+{
+    const int leaf = get_reverse_lexicographic_leaf(eviction_counter++, num_levels);
+
+    // Level 0 is the stash and level l + 1 is the bucket at depth l on the path.
+    std::vector<std::vector<Block>> levels(num_levels + 1);
+    std::vector<Bucket> path = storage->ReadPath(leaf);
+    for (unsigned int l = 0; l < num_levels; l++) {
+        levels[l + 1] = path.at(l).takeBlocks();
+        levels[l + 1].resize(bucket_size);
+    }
+    levels[0] = stash.get_blocks();
+
+    // PrepareDeepest: deepest[i] is the highest level above i holding a block that can reach level i.
+    std::vector<int> deepest(num_levels + 1, -1);
+    int source = -1;
+    int goal = -1;
+    for (unsigned int i = 0; i <= num_levels; i++) {
+        if (goal >= (int)i) {
+            deepest[i] = source;
+        }
+        int level = -1;
+        deepest_block(levels[i], leaf, level);
+        if (level > goal) {
+            goal = level;
+            source = i;
+        }
+    }
+
+    // PrepareTarget: target[i] is the level the block picked up at level i will be dropped at.
+    std::vector<int> target(num_levels + 1, -1);
+    int dest = -1;
+    source = -1;
+    for (int i = num_levels; i >= 0; i--) {
+        if (i == source) {
+            target[i] = dest;
+            dest = -1;
+            source = -1;
+        }
+        bool has_empty_slot = false;
+        if (i > 0) {
+            for (const Block& block : levels[i]) {
+                has_empty_slot |= block.index == -1;
+            }
+        }
+        if (((dest == -1 && has_empty_slot) || target[i] != -1) && deepest[i] != -1) {
+            source = deepest[i];
+            dest = i;
+        }
+    }
+
+    // EvictOnceFast: a single pass from the root carrying at most one block.
+    Block hold;
+    bool holding = false;
+    dest = -1;
+    for (unsigned int i = 0; i <= num_levels; i++) {
+        Block to_write;
+        bool writing = false;
+        if (holding && (int)i == dest) {
+            to_write = std::move(hold);
+            writing = true;
+            holding = false;
+            dest = -1;
+        }
+        if (target[i] != -1) {
+            int level = -1;
+            const int offset = deepest_block(levels[i], leaf, level);
+            hold = std::move(levels[i][offset]);
+            holding = true;
+            dest = target[i];
+            if (i == 0) {
+                stash.remove(hold.index);
+            } else {
+                levels[i][offset] = Block(); //dummy block
+            }
+        }
+        if (writing) {
+            for (Block& block : levels[i]) {
+                if (block.index == -1) {
+                    block = std::move(to_write);
+                    break;
+                }
+            }
+        }
+    }
+
+    for (unsigned int l = 0; l < num_levels; l++) {
+        path[l] = Bucket(levels[l + 1], block_size);
+    }
+    storage->WritePath(leaf, path);
+}
+
+int CircuitOram::reachable_level(const Block& block, const int& leaf)
+{
+    return Stash::common_level(block.leaf_id, leaf, num_levels) + 1;
+}
+
+int CircuitOram::deepest_block(const std::vector<Block>& blocks, const int& leaf, int& level)
+{
+    int offset = -1;
+    level = -1;
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if (blocks[i].index == -1) {
+            continue;
+        }
+        const int reachable = reachable_level(blocks[i], leaf);
+        if (reachable > level) {
+            level = reachable;
+            offset = i;
+        }
+    }
+    return offset;
+}
+
+std::string
+CircuitOram::access_direct(Operation op, const std::string& new_data)
+{
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
+    ODict::Node node = deserialize<ODict::Node>(new_data);
+    int blockIndex = node.id;
+    int newLeaf = node.pos_tag;
+
+    if (op == Operation::READ || blockIndex == 0) {
+        newLeaf = rand_gen->getRandomLeaf();
+    }
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
+}
+
+std::string
+CircuitOram::access(
+    Operation op,
+    const unsigned int& blockIndex,
+    const std::string& new_data)
+{
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
+
+    int newLeaf = rand_gen->getRandomLeaf();
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
+}
+
+void CircuitOram::check_data_size(const std::string& data)
+{
+    if (data.size() > block_size) {
+        throw std::runtime_error(
+            "The data has " + std::to_string(data.size()) + " bytes, but a block of this ORAM holds only " + std::to_string(block_size) + " bytes.");
+    }
+}
+
+int CircuitOram::P(int leaf, int level)
+{
+    return get_bucket_position(leaf, level, this->num_levels);
+}
+
+int* CircuitOram::getPositionMap()
+{
+    return nullptr;
+}
+
+vector<Block> CircuitOram::getStash()
+{
+    return this->stash.get_blocks();
+}
+
+int CircuitOram::getStashSize()
+{
+    return this->stash.size();
+}
+
+int CircuitOram::getNumLeaves()
+{
+    return this->num_leaves;
+}
+
+int CircuitOram::getNumLevels()
+{
+    return this->num_levels;
+}
+
+int CircuitOram::getNumBlocks()
+{
+    return this->num_blocks;
+}
+
+int CircuitOram::getNumBuckets()
+{
+    return this->num_buckets;
+}
@@ -0,0 +1,343 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/EncryptedStorage.h>
+#include <utils.h>
+
+#include <cstring>
+#include <stdexcept>
+
+#include <sodium.h>
+
+/* The keystream of a bucket starts with the one-time key of its tag; the ciphertext uses the blocks after it. */
+#define BUCKET_MAC_KEY_BYTES 32
+
+static_assert(BUCKET_MAC_KEY_BYTES == crypto_onetimeauth_KEYBYTES, "Wrong one-time key size!");
+static_assert(BUCKET_TAG_BYTES == crypto_onetimeauth_BYTES, "Wrong tag size!");
+
+/**
+ * A run of bytes to be XORed with the keystream of a bucket, starting at the given offset into that keystream.
+ * The counter block of keystream block i is the nonce followed by i in big-endian.
+ */
+struct KeystreamRange {
+    const unsigned char* nonce;
+
+    size_t offset;
+
+    size_t size;
+
+    const unsigned char* input;
+
+    unsigned char* output;
+};
+
+/* Produce the keystream of all the ranges with a single call to the SM4 kernel, and apply it. */
+static void apply_keystream(const SM4Cipher& cipher, const std::vector<KeystreamRange>& ranges)
+{
+    size_t blocks = 0;
+    for (auto iter = ranges.begin(); iter != ranges.end(); iter++) {
+        if (iter->size != 0) {
+            blocks += (iter->offset + iter->size - 1) / AES_BLOCK_BYTES - iter->offset / AES_BLOCK_BYTES + 1;
+        }
+    }
+
+    std::vector<unsigned char> keystream(blocks * AES_BLOCK_BYTES);
+    unsigned char* counter = keystream.data();
+    for (auto iter = ranges.begin(); iter != ranges.end(); iter++) {
+        if (iter->size == 0) {
+            continue;
+        }
+        const size_t last = (iter->offset + iter->size - 1) / AES_BLOCK_BYTES;
+        for (size_t i = iter->offset / AES_BLOCK_BYTES; i <= last; i++) {
+            memcpy(counter, iter->nonce, BUCKET_NONCE_BYTES);
+            counter[12] = (unsigned char)(i >> 24);
+            counter[13] = (unsigned char)(i >> 16);
+            counter[14] = (unsigned char)(i >> 8);
+            counter[15] = (unsigned char)i;
+            counter += AES_BLOCK_BYTES;
+        }
+    }
+    cipher.encrypt_blocks(keystream.data(), keystream.data(), blocks);
+
+    const unsigned char* stream = keystream.data();
+    for (auto iter = ranges.begin(); iter != ranges.end(); iter++) {
+        if (iter->size == 0) {
+            continue;
+        }
+        const unsigned char* const first = stream + iter->offset % AES_BLOCK_BYTES;
+        for (size_t i = 0; i < iter->size; i++) {
+            iter->output[i] = iter->input[i] ^ first[i];
+        }
+        stream += ((iter->offset + iter->size - 1) / AES_BLOCK_BYTES - iter->offset / AES_BLOCK_BYTES + 1) * AES_BLOCK_BYTES;
+    }
+}
+
+static const unsigned char zeros[BUCKET_MAC_KEY_BYTES] = { 0 };
+
+EncryptedStorage::EncryptedStorage(UntrustedStorageInterface* storage, const std::string& raw_key, const std::string& context)
+    : storage(storage)
+    , cipher(raw_key)
+    , context(context)
+    , num_levels(0)
+    , slots_per_bucket(0)
+    , block_size(0)
+    , sealed_block_size(0)
+    , bucket_bytes(0)
+    , sealed_bytes(0)
+{
+}
+
+EncryptedStorage::~EncryptedStorage()
+{
+    delete storage;
+}
+
+void EncryptedStorage::setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size)
+{
+    if (slots_per_bucket <= 0) {
+        throw std::runtime_error("A bucket must have at least one slot.");
+    }
+
+    this->slots_per_bucket = slots_per_bucket;
+    this->block_size = block_size;
+    num_levels = get_num_levels(total_number_of_buckets);
+
+    /* Spread the nonce and the tag over the slots, so that a sealed bucket is still a whole number of slots. */
+    sealed_block_size = block_size + (BUCKET_OVERHEAD + slots_per_bucket - 1) / slots_per_bucket;
+    bucket_bytes = slots_per_bucket * Block::slot_size(block_size);
+    sealed_bytes = slots_per_bucket * Block::slot_size(sealed_block_size);
+    storage->setCapacity(total_number_of_buckets, slots_per_bucket, sealed_block_size);
+}
+
+std::vector<int> EncryptedStorage::path_positions(const int& leaf, const int& start_level)
+{
+    std::vector<int> positions;
+    for (int l = start_level; l < num_levels; l++) {
+        positions.push_back(get_bucket_position(leaf, l, num_levels));
+    }
+    return positions;
+}
+
+void EncryptedStorage::compute_tag(const int& position, const unsigned char* ciphertext, const unsigned char* key, unsigned char* tag)
+{
+    const unsigned char position_bytes[4] = {
+        (unsigned char)(position >> 24), (unsigned char)(position >> 16), (unsigned char)(position >> 8), (unsigned char)position
+    };
+
+    crypto_onetimeauth_state state;
+    crypto_onetimeauth_init(&state, key);
+    crypto_onetimeauth_update(&state, (const unsigned char*)context.data(), context.size());
+    crypto_onetimeauth_update(&state, position_bytes, sizeof(position_bytes));
+    crypto_onetimeauth_update(&state, ciphertext, bucket_bytes);
+    crypto_onetimeauth_final(&state, tag);
+}
+
+std::vector<Bucket> EncryptedStorage::seal(const std::vector<int>& positions, const std::vector<Bucket>& buckets)
+{
+    if (positions.size() != buckets.size()) {
+        throw std::runtime_error("The number of buckets does not match the number of positions.");
+    }
+
+    std::vector<std::string> sealed(buckets.size());
+    std::vector<unsigned char> mac_keys(buckets.size() * BUCKET_MAC_KEY_BYTES);
+    std::vector<KeystreamRange> ranges;
+    ranges.reserve(2 * buckets.size());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        const std::string& buffer = buckets[i].getBuffer();
+        if (buffer.size() != bucket_bytes) {
+            throw std::runtime_error("The bucket does not match the geometry of the ORAM.");
+        }
+
+        sealed[i].assign(sealed_bytes, '\0');
+        unsigned char* const nonce = (unsigned char*)&sealed[i][0];
+        randombytes_buf(nonce, BUCKET_NONCE_BYTES);
+        ranges.push_back({ nonce, 0, BUCKET_MAC_KEY_BYTES, zeros, &mac_keys[i * BUCKET_MAC_KEY_BYTES] });
+        ranges.push_back({ nonce, BUCKET_MAC_KEY_BYTES, bucket_bytes, (const unsigned char*)buffer.data(), nonce + BUCKET_OVERHEAD });
+    }
+    apply_keystream(cipher, ranges);
+
+    std::vector<Bucket> result;
+    result.reserve(buckets.size());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        unsigned char* const nonce = (unsigned char*)&sealed[i][0];
+        compute_tag(positions[i], nonce + BUCKET_OVERHEAD, &mac_keys[i * BUCKET_MAC_KEY_BYTES], nonce + BUCKET_NONCE_BYTES);
+        result.emplace_back(std::move(sealed[i]), sealed_block_size);
+    }
+    sodium_memzero(mac_keys.data(), mac_keys.size());
+    return result;
+}
+
+std::vector<Bucket> EncryptedStorage::open(
+    const std::vector<int>& positions, const std::vector<Bucket>& sealed, const std::vector<int>* slots)
+{
+    if (positions.size() != sealed.size()) {
+        throw std::runtime_error("The storage returned " + std::to_string(sealed.size()) + " buckets, but " + std::to_string(positions.size()) + " were requested.");
+    }
+
+    const size_t slot_bytes = Block::slot_size(block_size);
+    std::vector<std::string> plain(sealed.size());
+    std::vector<unsigned char> mac_keys(sealed.size() * BUCKET_MAC_KEY_BYTES);
+    std::vector<KeystreamRange> ranges;
+
+    /* First the one-time keys and the slot headers, ... */
+    for (size_t i = 0; i < sealed.size(); i++) {
+        const std::string& buffer = sealed[i].getBuffer();
+        if (buffer.size() != sealed_bytes) {
+            throw std::runtime_error("The sealed bucket does not match the geometry of the ORAM.");
+        }
+
+        const unsigned char* const nonce = (const unsigned char*)buffer.data();
+        plain[i].assign(bucket_bytes, '\0');
+        unsigned char* const output = (unsigned char*)&plain[i][0];
+        ranges.push_back({ nonce, 0, BUCKET_MAC_KEY_BYTES, zeros, &mac_keys[i * BUCKET_MAC_KEY_BYTES] });
+        for (int s = 0; s < slots_per_bucket; s++) {
+            if (slots == nullptr || (*slots)[i] == s) {
+                ranges.push_back({ nonce, BUCKET_MAC_KEY_BYTES + s * slot_bytes, sizeof(SlotHeader),
+                    nonce + BUCKET_OVERHEAD + s * slot_bytes, output + s * slot_bytes });
+            }
+        }
+    }
+    apply_keystream(cipher, ranges);
+
+    for (size_t i = 0; i < sealed.size(); i++) {
+        const unsigned char* const nonce = (const unsigned char*)sealed[i].getBuffer().data();
+        unsigned char tag[BUCKET_TAG_BYTES];
+        compute_tag(positions[i], nonce + BUCKET_OVERHEAD, &mac_keys[i * BUCKET_MAC_KEY_BYTES], tag);
+        if (crypto_verify_16(tag, nonce + BUCKET_NONCE_BYTES) != 0) {
+            throw std::runtime_error("The bucket at position " + std::to_string(positions[i]) + " fails authentication.");
+        }
+    }
+    sodium_memzero(mac_keys.data(), mac_keys.size());
+
+    /* ... then the payload bytes in use of the real slots. */
+    ranges.clear();
+    for (size_t i = 0; i < sealed.size(); i++) {
+        const unsigned char* const nonce = (const unsigned char*)sealed[i].getBuffer().data();
+        unsigned char* const output = (unsigned char*)&plain[i][0];
+        for (int s = 0; s < slots_per_bucket; s++) {
+            if (slots != nullptr && (*slots)[i] != s) {
+                continue;
+            }
+            const SlotHeader header = Block::read_header((const char*)output + s * slot_bytes);
+            if (header.index < 0 || header.length > (uint32_t)block_size) {
+                continue;
+            }
+            ranges.push_back({ nonce, BUCKET_MAC_KEY_BYTES + s * slot_bytes + sizeof(SlotHeader), header.length,
+                nonce + BUCKET_OVERHEAD + s * slot_bytes + sizeof(SlotHeader), output + s * slot_bytes + sizeof(SlotHeader) });
+        }
+    }
+    apply_keystream(cipher, ranges);
+
+    std::vector<Bucket> buckets;
+    buckets.reserve(plain.size());
+    for (size_t i = 0; i < plain.size(); i++) {
+        buckets.emplace_back(std::move(plain[i]), block_size);
+    }
+    return buckets;
+}
+
+Bucket EncryptedStorage::ReadBucket(const int& position)
+{
+    return open({ position }, { storage->ReadBucket(position) })[0];
+}
+
+void EncryptedStorage::WriteBucket(const int& position, const Bucket& bucket_to_write)
+{
+    storage->WriteBucket(position, seal({ position }, { bucket_to_write })[0]);
+}
+
+std::vector<Bucket> EncryptedStorage::ReadPath(const int& leaf, const int& start_level)
+{
+    return open(path_positions(leaf, start_level), storage->ReadPath(leaf, start_level));
+}
+
+void EncryptedStorage::WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+{
+    if ((int)buckets_to_write.size() != num_levels - start_level) {
+        throw std::runtime_error("The path does not match the height of the ORAM tree.");
+    }
+
+    storage->WritePath(leaf, seal(path_positions(leaf, start_level), buckets_to_write), start_level);
+}
+
+std::vector<Block> EncryptedStorage::ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level)
+{
+    if ((int)offsets.size() != num_levels - start_level) {
+        throw std::runtime_error("The offsets do not match the height of the ORAM tree.");
+    }
+
+    const std::vector<Bucket> buckets = open(path_positions(leaf, start_level), storage->ReadPath(leaf, start_level), &offsets);
+    std::vector<Block> blocks;
+    blocks.reserve(buckets.size());
+    for (size_t i = 0; i < buckets.size(); i++) {
+        blocks.push_back(buckets[i].getBlockAt(offsets[i]));
+    }
+    return blocks;
+}
+
+std::vector<Bucket> EncryptedStorage::ReadBuckets(const std::vector<int>& positions)
+{
+    return open(positions, storage->ReadBuckets(positions));
+}
+
+std::future<std::vector<Bucket>> EncryptedStorage::ReadBucketsAsync(const std::vector<int>& positions)
+{
+    std::future<std::vector<Bucket>> sealed = storage->ReadBucketsAsync(positions);
+    return std::async(std::launch::deferred, [this, positions, sealed = std::move(sealed)]() mutable {
+        return open(positions, sealed.get());
+    });
+}
+
+void EncryptedStorage::WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    storage->WriteBuckets(positions, seal(positions, buckets_to_write));
+}
+
+void EncryptedStorage::LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write)
+{
+    std::vector<int> positions(buckets_to_write.size());
+    for (size_t i = 0; i < positions.size(); i++) {
+        positions[i] = first_position + i;
+    }
+    storage->LoadBuckets(first_position, seal(positions, buckets_to_write));
+}
+
+void EncryptedStorage::flush()
+{
+    storage->flush();
+}
+
+bool EncryptedStorage::is_vectored()
+{
+    return storage->is_vectored();
+}
+
+void EncryptedStorage::add_read(VectoredMessage& message, const std::vector<int>& positions)
+{
+    storage->add_read(message, positions);
+}
+
+std::vector<Bucket> EncryptedStorage::take_read(BucketsReadResponse& response, const std::vector<int>& positions)
+{
+    return open(positions, storage->take_read(response, positions));
+}
+
+void EncryptedStorage::add_write(
+    VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    storage->add_write(message, positions, seal(positions, buckets_to_write));
+}
@@ -0,0 +1,137 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/BoundedRandomForOram.h>
+#include <oram/OramPositionMap.h>
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+OramPositionMap::OramPositionMap(
+    const unsigned int& num_blocks, RandForOramInterface* rand_gen,
+    const unsigned int& bucket_size, const unsigned int& threshold,
+    const std::string& key, const StorageFactory& create_storage,
+    const unsigned int& entries_per_block, const unsigned int& depth)
+    : num_blocks(num_blocks)
+    , entries_per_block(entries_per_block)
+    , bucket_size(bucket_size)
+    , threshold(threshold)
+    , key(key)
+    , create_storage(create_storage)
+    , depth(depth)
+    , rand_gen(rand_gen)
+    , oram(nullptr)
+{
+    if (entries_per_block < 2) {
+        throw std::runtime_error("A recursive position map must pack at least two entries per block.");
+    }
+
+    inner_rand_gen = new BoundedRandomForOram();
+    storage = create_storage(key + "#pos" + std::to_string(depth));
+}
+
+OramPositionMap::~OramPositionMap()
+{
+    delete oram;
+    delete storage;
+    delete inner_rand_gen;
+}
+
+void OramPositionMap::build(const std::vector<std::pair<unsigned int, std::string>>& blocks)
+{
+    delete oram;
+    oram = nullptr;
+
+    const unsigned int inner_blocks = (num_blocks + entries_per_block - 1) / entries_per_block;
+    PositionMapInterface* inner_map = nullptr;
+    if (inner_blocks > threshold) {
+        inner_map = new OramPositionMap(
+            inner_blocks, inner_rand_gen, bucket_size, threshold, key, create_storage, entries_per_block, depth + 1);
+    }
+    oram = new OramReadPathEviction(
+        storage, inner_rand_gen, bucket_size, inner_blocks, blocks, entries_per_block * sizeof(uint32_t), inner_map);
+}
+
+void OramPositionMap::check_bound(const unsigned int& block_index)
+{
+    if (block_index >= num_blocks) {
+        throw std::runtime_error(
+            "You are trying to access Block " + std::to_string(block_index) + ", but this ORAM contains only " + std::to_string(num_blocks) + " blocks.");
+    }
+}
+
+unsigned int OramPositionMap::access_entry(const unsigned int& block_index, const unsigned int* leaf)
+{
+    check_bound(block_index);
+
+    // The inner ORAM is built on first use unless load() has already bulk-loaded it, so that every level
+    // uploads its tree once.
+    if (oram == nullptr) {
+        build(std::vector<std::pair<unsigned int, std::string>>());
+    }
+
+    // An entry stores leaf + 1 so that the zero-filled entries of a fresh block read as unmapped.
+    const size_t offset = (block_index % entries_per_block) * sizeof(uint32_t);
+    uint32_t entry = 0;
+    oram->access_update(block_index / entries_per_block, [&](std::string& data) {
+        data.resize(entries_per_block * sizeof(uint32_t), '\0');
+        memcpy(&entry, &data[offset], sizeof(uint32_t));
+        if (leaf != nullptr) {
+            const uint32_t new_entry = *leaf + 1;
+            memcpy(&data[offset], &new_entry, sizeof(uint32_t));
+        }
+    });
+
+    return entry == 0 ? rand_gen->getRandomLeaf() : entry - 1;
+}
+
+unsigned int OramPositionMap::get(const unsigned int& block_index)
+{
+    return access_entry(block_index, nullptr);
+}
+
+void OramPositionMap::set(const unsigned int& block_index, const unsigned int& leaf)
+{
+    access_entry(block_index, &leaf);
+}
+
+unsigned int OramPositionMap::exchange(const unsigned int& block_index, const unsigned int& leaf)
+{
+    return access_entry(block_index, &leaf);
+}
+
+unsigned int OramPositionMap::size()
+{
+    return num_blocks;
+}
+
+void OramPositionMap::load(const std::vector<std::pair<unsigned int, unsigned int>>& leaves)
+{
+    std::map<unsigned int, std::string> packed;
+    for (const auto& entry : leaves) {
+        check_bound(entry.first);
+
+        std::string& data = packed[entry.first / entries_per_block];
+        data.resize(entries_per_block * sizeof(uint32_t), '\0');
+        const uint32_t new_entry = entry.second + 1;
+        memcpy(&data[(entry.first % entries_per_block) * sizeof(uint32_t)], &new_entry, sizeof(uint32_t));
+    }
+
+    build(std::vector<std::pair<unsigned int, std::string>>(packed.begin(), packed.end()));
+}
@@ -15,23 +15,41 @@
  along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <oram/ArrayPositionMap.h>
 #include <oram/OramReadPathEviction.h>
 #include <utils.h>
 
 #include <cmath>
 #include <iostream>
+#include <numeric>
+#include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <strings.h>
+#include <unordered_map>
 
 OramReadPathEviction::OramReadPathEviction(
     UntrustedStorageInterface* storage,
     RandForOramInterface* rand_gen, const unsigned int& bucket_size,
-    const unsigned int& num_blocks, const unsigned int& block_size)
+    const unsigned int& num_blocks, const unsigned int& block_size,
+    PositionMapInterface* position_map)
+    : OramReadPathEviction(
+        storage, rand_gen, bucket_size, num_blocks,
+        std::vector<std::pair<unsigned int, std::string>>(), block_size, position_map)
+{
+}
+
+OramReadPathEviction::OramReadPathEviction(
+    UntrustedStorageInterface* storage,
+    RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+    const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+    const unsigned int& block_size, PositionMapInterface* position_map)
 {
     this->storage = storage;
     this->rand_gen = rand_gen;
     this->bucket_size = bucket_size;
+    this->block_size = block_size;
     this->num_blocks = num_blocks;
     this->num_levels = std::ceil(log10(num_blocks) / log10(2)) + 1;
     this->num_buckets = (unsigned int)std::pow(2, num_levels) - 1;
@@ -42,23 +60,38 @@ OramReadPathEviction::OramReadPathEviction(
     }
 
     this->num_leaves = (unsigned int)std::pow(2, num_levels - 1);
-    Bucket::resetState();
-    Bucket::setMaxSize(bucket_size);
     this->rand_gen->setBound(num_leaves);
-    this->storage->setCapacity(num_buckets);
+    this->storage->setCapacity(num_buckets, bucket_size, block_size);
 
-    for (unsigned int i = 0; i < num_blocks; i++) {
-        position_map[i] = rand_gen->getRandomLeaf();
+    this->position_map = position_map != nullptr ? position_map : new ArrayPositionMap(num_blocks, rand_gen);
+    if (this->position_map->size() < num_blocks) {
+        throw std::runtime_error("The position map does not cover every block.");
     }
 
-    for (unsigned int i = 0; i < num_buckets; i++) {
-        Bucket init_bkt = Bucket();
-        for (unsigned int j = 0; j < bucket_size; j++) {
-            init_bkt.addBlock(Block());
+    std::vector<std::pair<unsigned int, unsigned int>> leaves;
+    leaves.reserve(blocks.size());
+    for (const auto& block : blocks) {
+        if (stash.find(block.first) != nullptr) {
+            throw std::runtime_error("Block " + std::to_string(block.first) + " is loaded more than once.");
         }
-        storage->WriteBucket(i, Bucket(init_bkt));
+        check_data_size(block.second);
+        const int leaf = rand_gen->getRandomLeaf();
+        leaves.emplace_back(block.first, leaf);
+        stash.add(Block(leaf, block.first, block.second));
     }
+    this->position_map->load(leaves);
+
+    // The whole tree is the union of all paths, so it is packed by a single eviction over every bucket.
+    std::vector<int> positions(num_buckets);
+    std::iota(positions.begin(), positions.end(), 0);
+    storage->LoadBuckets(0, stash.evict_buckets(positions, num_levels, bucket_size, block_size));
+}
+
+OramReadPathEviction::~OramReadPathEviction()
+{
+    delete position_map;
 }
+
 std::string
 OramReadPathEviction::access_handler(
     Operation op, const unsigned int& blockIndex,
@@ -66,90 +99,193 @@ OramReadPathEviction::access_handler(
 {
     std::string data; // The data to be returned.
 
-    for (unsigned int i = 0; i < num_levels; i++) {
-        vector<Block> blocks = storage->ReadBucket(OramReadPathEviction::P(oldLeaf, i)).getBlocks();
-        for (Block b : blocks) {
-            if (b.index != -1) {
-                stash.push_back(b);
-            }
-        }
-    }
+    read_path(oldLeaf);
 
-    auto iter = std::find_if(stash.begin(), stash.end(), [blockIndex](const Block& block) {
-        return block.index == (int)blockIndex;
-    });
+    Block* block = stash.find(blockIndex);
+    if (block != nullptr) {
+        block->leaf_id = newLeaf;
+    }
 
     if (op == Operation::WRITE) {
-        if (iter == stash.end()) {
-            Block newBlock = Block(newLeaf, blockIndex, new_data);
-            stash.push_back(newBlock);
+        if (block == nullptr) {
+            stash.add(Block(newLeaf, blockIndex, new_data));
         } else {
-            (*iter).data = new_data;
+            block->data = new_data;
         }
     } else {
-        if (iter != stash.end()) {
-            data = (*iter).data;
+        if (block != nullptr) {
+            data = block->data;
         }
     }
 
     // Eviction steps: write to the same path that was read from.
-    for (int l = num_levels - 1; l >= 0; l--) {
+    write_path(oldLeaf);
 
-        std::vector<int> bid_evicted;
-        Bucket bucket = Bucket();
-        int Pxl = P(oldLeaf, l);
-        int counter = 0;
+    return data;
+}
 
-        for (Block b_instash : stash) {
-            if ((unsigned)counter >= bucket_size) {
-                break;
+void OramReadPathEviction::read_path(const int& leaf)
+{
+    // Fetch the whole path in one round trip.
+    vector<Bucket> path = storage->ReadPath(leaf);
+    for (unsigned int i = 0; i < path.size(); i++) {
+        for (Block& b : path[i].takeBlocks()) {
+            if (b.index != -1) {
+                stash.add(std::move(b));
             }
-            Block be_evicted = Block(b_instash);
-            if (Pxl == P(position_map[be_evicted.index], l)) {
-                bucket.addBlock(be_evicted);
+        }
+    }
+}
 
-                bid_evicted.push_back(be_evicted.index);
-                counter++;
-            }
+void OramReadPathEviction::write_path(const int& leaf)
+{
+    storage->WritePath(leaf, stash.evict(leaf, num_levels, bucket_size, block_size));
+}
+
+std::vector<std::string>
+OramReadPathEviction::access_batch(const std::vector<BatchOperation>& ops)
+{
+    const std::vector<int> positions = begin_batch(ops);
+    std::vector<Bucket> buckets = storage->ReadBuckets(positions);
+    std::vector<Bucket> evicted;
+    std::vector<std::string> results = finish_batch(ops, buckets, evicted);
+    storage->WriteBuckets(positions, evicted);
+
+    return results;
+}
+
+void OramReadPathEviction::check_batch(const std::vector<BatchOperation>& ops)
+{
+    for (const BatchOperation& op : ops) {
+        if (op.block_index >= position_map->size()) {
+            throw std::runtime_error(
+                "You are trying to access Block " + std::to_string(op.block_index) + ", but this ORAM contains only " + std::to_string(position_map->size()) + " blocks.");
+        }
+        if (op.op == Operation::WRITE) {
+            check_data_size(op.data);
+        }
+    }
+}
+
+std::vector<int>
+OramReadPathEviction::begin_batch(const std::vector<BatchOperation>& ops)
+{
+    // Check the whole batch first: once a block is remapped, its path has to be read and evicted.
+    check_batch(ops);
+
+    // Remap every distinct block once. A repeated block reads a random path instead, so that the number
+    // of paths does not reveal the repetition.
+    batch_leaves.clear();
+    std::set<int> positions;
+    for (const BatchOperation& op : ops) {
+        int leaf = rand_gen->getRandomLeaf();
+        if (batch_leaves.find(op.block_index) == batch_leaves.end()) {
+            batch_leaves[op.block_index] = leaf;
+            leaf = position_map->exchange(op.block_index, leaf);
+        }
+        for (unsigned int l = 0; l < num_levels; l++) {
+            positions.insert(P(leaf, l));
         }
+    }
 
-        //remove from the stash
-        for (unsigned int i = 0; i < bid_evicted.size(); i++) {
-            for (unsigned int j = 0; j < stash.size(); j++) {
-                Block b_instash = stash.at(j);
-                if (b_instash.index == bid_evicted.at(i)) {
-                    this->stash.erase(this->stash.begin() + j);
+    // Buckets shared by several paths are fetched once.
+    batch_positions.assign(positions.begin(), positions.end());
+    return batch_positions;
+}
 
-                    break;
-                }
+std::vector<std::string>
+OramReadPathEviction::finish_batch(
+    const std::vector<BatchOperation>& ops, std::vector<Bucket>& buckets, std::vector<Bucket>& evicted)
+{
+    if (buckets.size() != batch_positions.size()) {
+        throw std::runtime_error(
+            "The batch needs " + std::to_string(batch_positions.size()) + " buckets, but " + std::to_string(buckets.size()) + " were read.");
+    }
+
+    for (Bucket& bucket : buckets) {
+        for (Block& b : bucket.takeBlocks()) {
+            if (b.index != -1) {
+                stash.add(std::move(b));
             }
         }
+    }
+
+    std::vector<std::string> results;
+    results.reserve(ops.size());
+    for (const BatchOperation& op : ops) {
+        const int newLeaf = batch_leaves.at(op.block_index);
+        Block* block = stash.find(op.block_index);
+        if (block != nullptr) {
+            block->leaf_id = newLeaf;
+        }
 
-        while ((unsigned)counter < bucket_size) {
-            bucket.addBlock(Block()); //dummy block
-            counter++;
+        if (op.op == Operation::WRITE) {
+            if (block == nullptr) {
+                stash.add(Block(newLeaf, op.block_index, op.data));
+            } else {
+                block->data = op.data;
+            }
+            results.emplace_back();
+        } else {
+            results.push_back(block == nullptr ? std::string() : block->data);
         }
-        storage->WriteBucket(Pxl, bucket);
     }
 
+    evicted = stash.evict_buckets(batch_positions, num_levels, bucket_size, block_size);
+
+    return results;
+}
+
+std::string
+OramReadPathEviction::access_update(
+    const unsigned int& blockIndex,
+    const std::function<void(std::string&)>& update)
+{
+    int newLeaf = rand_gen->getRandomLeaf();
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    read_path(oldLeaf);
+
+    Block* block = stash.find(blockIndex);
+    if (block == nullptr) {
+        stash.add(Block(newLeaf, blockIndex, std::string()));
+        block = stash.find(blockIndex);
+    }
+    block->leaf_id = newLeaf;
+
+    const std::string data = block->data;
+    std::string updated = data;
+    update(updated);
+    if (updated.size() > block_size) {
+        // Write the path back first, so that the server does not keep stale copies of the blocks in the stash.
+        write_path(oldLeaf);
+        check_data_size(updated);
+    }
+    block->data = std::move(updated);
+
+    write_path(oldLeaf);
+
     return data;
 }
 
 std::string
 OramReadPathEviction::access_direct(Operation op, const std::string& new_data)
 {
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
     /*if (!instanceof<ODict::Node, int>(newdata))
     {
         throw std::runtime_error("Cannot access directly with a non-node data array!");
     }*/
     ODict::Node node = deserialize<ODict::Node>(new_data);
     int blockIndex = node.id;
-    int oldLeaf = position_map[blockIndex];
     int newLeaf = node.pos_tag;
 
     if (op == Operation::READ || blockIndex == 0) {
         newLeaf = rand_gen->getRandomLeaf();
     }
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
 
     return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
 }
@@ -160,10 +296,22 @@ OramReadPathEviction::access(
     const unsigned int& blockIndex,
     const std::string& new_data)
 {
-    int oldLeaf = position_map[blockIndex];
-    position_map[blockIndex] = rand_gen->getRandomLeaf();
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
 
-    return access_handler(op, blockIndex, oldLeaf, position_map[blockIndex], new_data);
+    int newLeaf = rand_gen->getRandomLeaf();
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
+}
+
+void OramReadPathEviction::check_data_size(const std::string& data)
+{
+    if (data.size() > block_size) {
+        throw std::runtime_error(
+            "The data has " + std::to_string(data.size()) + " bytes, but a block of this ORAM holds only " + std::to_string(block_size) + " bytes.");
+    }
 }
 
 int OramReadPathEviction::P(int leaf, int level)
@@ -173,7 +321,7 @@ int OramReadPathEviction::P(int leaf, int level)
     * INPUT: leaf in range 0 to num_leaves - 1, level in range 0 to num_levels - 1. 
     * OUTPUT: Returns the location in the storage of the bucket which is at the input level and leaf.
     */
-    return (1 << level) - 1 + (leaf >> (this->num_levels - level - 1));
+    return get_bucket_position(leaf, level, this->num_levels);
 }
 
 /*
@@ -189,12 +337,12 @@ int* OramReadPathEviction::getPositionMap()
 
 vector<Block> OramReadPathEviction::getStash()
 {
-    return this->stash;
+    return this->stash.get_blocks();
 }
 
 int OramReadPathEviction::getStashSize()
 {
-    return (this->stash).size();
+    return this->stash.size();
 }
 
 int OramReadPathEviction::getNumLeaves()
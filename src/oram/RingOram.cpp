@@ -0,0 +1,330 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/ArrayPositionMap.h>
+#include <oram/RingOram.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+RingOram::RingOram(
+    UntrustedStorageInterface* storage,
+    RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+    const unsigned int& num_blocks, const unsigned int& block_size,
+    PositionMapInterface* position_map,
+    const unsigned int& dummy_size, const unsigned int& eviction_rate)
+    : RingOram(
+        storage, rand_gen, bucket_size, num_blocks,
+        std::vector<std::pair<unsigned int, std::string>>(), block_size, position_map, dummy_size, eviction_rate)
+{
+}
+
+RingOram::RingOram(
+    UntrustedStorageInterface* storage,
+    RandForOramInterface* rand_gen, const unsigned int& bucket_size,
+    const unsigned int& num_blocks, const std::vector<std::pair<unsigned int, std::string>>& blocks,
+    const unsigned int& block_size, PositionMapInterface* position_map,
+    const unsigned int& dummy_size, const unsigned int& eviction_rate)
+{
+    if (dummy_size == 0 || eviction_rate == 0) {
+        throw std::runtime_error("Ring ORAM needs at least one dummy slot per bucket and a positive eviction rate.");
+    }
+
+    this->storage = storage;
+    this->rand_gen = rand_gen;
+    this->bucket_size = bucket_size;
+    this->block_size = block_size;
+    this->dummy_size = dummy_size;
+    this->eviction_rate = eviction_rate;
+    this->num_blocks = num_blocks;
+    this->num_levels = std::ceil(log10(num_blocks) / log10(2)) + 1;
+    this->num_buckets = (unsigned int)std::pow(2, num_levels) - 1;
+    this->round = 0;
+    this->eviction_counter = 0;
+
+    if (this->num_buckets * this->bucket_size < this->num_blocks) //deal with precision loss
+    {
+        throw std::runtime_error("Not enough space for the acutal number of blocks.");
+    }
+
+    this->num_leaves = (unsigned int)std::pow(2, num_levels - 1);
+    this->rand_gen->setBound(num_leaves);
+    this->storage->setCapacity(num_buckets, bucket_size + dummy_size, block_size);
+    this->position_map = position_map != nullptr ? position_map : new ArrayPositionMap(num_blocks, rand_gen);
+    if (this->position_map->size() < num_blocks) {
+        throw std::runtime_error("The position map does not cover every block.");
+    }
+
+    const unsigned int slots = bucket_size + dummy_size;
+    metadata.assign(num_buckets, BucketMetadata { std::vector<int>(slots, -1), std::vector<bool>(slots, true), 0 });
+
+    std::vector<std::pair<unsigned int, unsigned int>> leaves;
+    leaves.reserve(blocks.size());
+    for (const auto& block : blocks) {
+        if (stash.find(block.first) != nullptr) {
+            throw std::runtime_error("Block " + std::to_string(block.first) + " is loaded more than once.");
+        }
+        check_data_size(block.second);
+        const int leaf = rand_gen->getRandomLeaf();
+        leaves.emplace_back(block.first, leaf);
+        stash.add(Block(leaf, block.first, block.second));
+    }
+    this->position_map->load(leaves);
+
+    std::vector<int> positions(num_buckets);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::vector<Bucket> tree = stash.evict_buckets(positions, num_levels, bucket_size, block_size);
+    for (unsigned int i = 0; i < num_buckets; i++) {
+        tree[i] = permute_bucket(tree[i].takeBlocks(), metadata[i]);
+    }
+    storage->LoadBuckets(0, tree);
+}
+
+RingOram::~RingOram()
+{
+    delete position_map;
+}
+
+std::string
+RingOram::access_handler(
+    Operation op, const unsigned int& blockIndex,
+    const int& oldLeaf, const int& newLeaf, const std::string& new_data)
+{
+    std::string data; // The data to be returned.
+
+    read_path(oldLeaf, blockIndex);
+
+    Block* block = stash.find(blockIndex);
+    if (block != nullptr) {
+        block->leaf_id = newLeaf;
+    }
+
+    if (op == Operation::WRITE) {
+        if (block == nullptr) {
+            stash.add(Block(newLeaf, blockIndex, new_data));
+        } else {
+            block->data = new_data;
+        }
+    } else {
+        if (block != nullptr) {
+            data = block->data;
+        }
+    }
+
+    round = (round + 1) % eviction_rate;
+    if (round == 0) {
+        evict_path();
+    }
+    early_reshuffle(oldLeaf);
+
+    return data;
+}
+
+void RingOram::read_path(const int& leaf, const unsigned int& blockIndex)
+{
+    std::vector<int> offsets(num_levels);
+    int found_level = -1;
+
+    for (unsigned int l = 0; l < num_levels; l++) {
+        BucketMetadata& meta = metadata[P(leaf, l)];
+        int slot = -1;
+
+        if (found_level == -1) {
+            for (unsigned int s = 0; s < meta.addresses.size(); s++) {
+                if (meta.valid[s] && meta.addresses[s] == (int)blockIndex) {
+                    slot = s;
+                    found_level = l;
+                    break;
+                }
+            }
+        }
+
+        // Otherwise read a dummy slot that has not been touched since the last reshuffle.
+        if (slot == -1) {
+            std::vector<int> dummies;
+            for (unsigned int s = 0; s < meta.addresses.size(); s++) {
+                if (meta.valid[s] && meta.addresses[s] == -1) {
+                    dummies.push_back(s);
+                }
+            }
+            if (dummies.empty()) {
+                throw std::runtime_error("Bucket " + std::to_string(P(leaf, l)) + " has no valid dummy slot left.");
+            }
+            slot = dummies[random_below(dummies.size())];
+        }
+
+        meta.valid[slot] = false;
+        meta.count++;
+        offsets[l] = slot;
+    }
+
+    std::vector<Block> blocks = storage->ReadBlocks(leaf, offsets);
+    if (found_level != -1) {
+        stash.add(std::move(blocks.at(found_level)));
+    }
+}
+
+void RingOram::evict_path()
+{
+    const int leaf = get_reverse_lexicographic_leaf(eviction_counter++, num_levels);
+
+    std::vector<Bucket> path = storage->ReadPath(leaf);
+    for (unsigned int l = 0; l < num_levels; l++) {
+        const BucketMetadata& meta = metadata[P(leaf, l)];
+        std::vector<Block> blocks = path.at(l).takeBlocks();
+        for (unsigned int s = 0; s < meta.addresses.size() && s < blocks.size(); s++) {
+            if (meta.valid[s] && meta.addresses[s] != -1) {
+                stash.add(std::move(blocks[s]));
+            }
+        }
+    }
+
+    path = stash.evict(leaf, num_levels, bucket_size, block_size);
+    for (unsigned int l = 0; l < num_levels; l++) {
+        path[l] = permute_bucket(path[l].takeBlocks(), metadata[P(leaf, l)]);
+    }
+    storage->WritePath(leaf, path);
+}
+
+void RingOram::early_reshuffle(const int& leaf)
+{
+    for (unsigned int l = 0; l < num_levels; l++) {
+        const int position = P(leaf, l);
+        BucketMetadata& meta = metadata[position];
+        if (meta.count < dummy_size) {
+            continue;
+        }
+
+        // Keep the real blocks that have not been read yet and refresh the dummies.
+        std::vector<Block> blocks = storage->ReadBucket(position).takeBlocks();
+        std::vector<Block> real_blocks;
+        for (unsigned int s = 0; s < meta.addresses.size() && s < blocks.size(); s++) {
+            if (meta.valid[s] && meta.addresses[s] != -1) {
+                real_blocks.push_back(std::move(blocks[s]));
+            }
+        }
+        storage->WriteBucket(position, permute_bucket(std::move(real_blocks), meta));
+    }
+}
+
+Bucket RingOram::permute_bucket(std::vector<Block>&& blocks, BucketMetadata& meta)
+{
+    const unsigned int slots = bucket_size + dummy_size;
+    while (blocks.size() < slots) {
+        blocks.emplace_back(); //dummy block
+    }
+    std::shuffle(blocks.begin(), blocks.end(), rng);
+
+    for (unsigned int s = 0; s < slots; s++) {
+        meta.addresses[s] = blocks[s].index;
+        meta.valid[s] = true;
+    }
+    meta.count = 0;
+
+    return Bucket(blocks, block_size);
+}
+
+unsigned int RingOram::random_below(const unsigned int& bound)
+{
+    return std::uniform_int_distribution<unsigned int>(0, bound - 1)(rng);
+}
+
+std::string
+RingOram::access_direct(Operation op, const std::string& new_data)
+{
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
+    ODict::Node node = deserialize<ODict::Node>(new_data);
+    int blockIndex = node.id;
+    int newLeaf = node.pos_tag;
+
+    if (op == Operation::READ || blockIndex == 0) {
+        newLeaf = rand_gen->getRandomLeaf();
+    }
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
+}
+
+std::string
+RingOram::access(
+    Operation op,
+    const unsigned int& blockIndex,
+    const std::string& new_data)
+{
+    if (op == Operation::WRITE) {
+        check_data_size(new_data);
+    }
+
+    int newLeaf = rand_gen->getRandomLeaf();
+    int oldLeaf = position_map->exchange(blockIndex, newLeaf);
+
+    return access_handler(op, blockIndex, oldLeaf, newLeaf, new_data);
+}
+
+void RingOram::check_data_size(const std::string& data)
+{
+    if (data.size() > block_size) {
+        throw std::runtime_error(
+            "The data has " + std::to_string(data.size()) + " bytes, but a block of this ORAM holds only " + std::to_string(block_size) + " bytes.");
+    }
+}
+
+int RingOram::P(int leaf, int level)
+{
+    return get_bucket_position(leaf, level, this->num_levels);
+}
+
+int* RingOram::getPositionMap()
+{
+    return nullptr;
+}
+
+vector<Block> RingOram::getStash()
+{
+    return this->stash.get_blocks();
+}
+
+int RingOram::getStashSize()
+{
+    return this->stash.size();
+}
+
+int RingOram::getNumLeaves()
+{
+    return this->num_leaves;
+}
+
+int RingOram::getNumLevels()
+{
+    return this->num_levels;
+}
+
+int RingOram::getNumBlocks()
+{
+    return this->num_blocks;
+}
+
+int RingOram::getNumBuckets()
+{
+    return this->num_buckets;
+}
@@ -19,6 +19,7 @@
 #include <plog/Log.h>
 #include <utils.h>
 
+#include <chrono>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -28,75 +29,586 @@
 #include <grpc++/client_context.h>
 #include <grpc/grpc.h>
 
-ServerStorage::ServerStorage(const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub* stub_)
+ServerStorage::ServerStorage(
+    const unsigned int& oram_id, const bool& is_odict, const std::string& key, Seal::Stub* stub_,
+    const bool& async_write, const bool& use_session)
     : stub_(stub_)
     , oram_id(oram_id)
     , is_odict(is_odict)
     , key(key)
+    , handle(0)
+    , async_write(async_write)
+    , use_session(use_session)
+    , unanswered(0)
 {
     PLOG(plog::info) << "The server storage interface class is initialized.";
 }
 
-void ServerStorage::setCapacity(const int& totalNumOfBuckets)
+ServerStorage::~ServerStorage()
 {
+    try {
+        flush();
+    } catch (const std::exception& e) {
+        PLOG(plog::error) << e.what();
+    }
+    if (session != nullptr) {
+        const grpc::Status status = close_session();
+        if (!status.ok()) {
+            PLOG(plog::error) << status.error_message();
+        }
+    }
+
+    cq.Shutdown();
+    void* tag;
+    bool ok;
+    while (cq.Next(&tag, &ok)) {
+    }
+}
+
+void ServerStorage::setCapacity(const int& totalNumOfBuckets, const int& slots_per_bucket, const int& block_size)
+{
+    flush();
+
     capacity = totalNumOfBuckets;
+    num_levels = get_num_levels(totalNumOfBuckets);
+    this->block_size = block_size;
 
     grpc::ClientContext context;
-    google::protobuf::Empty e;
+    BucketSetResponse response;
     BucketSetMessage message;
     message.set_is_odict(is_odict);
     message.set_oram_id(oram_id);
     message.set_number_of_buckets(totalNumOfBuckets);
+    message.set_slots_per_bucket(slots_per_bucket);
+    message.set_block_size(block_size);
     message.set_map_key(key);
 
-    grpc::Status status = stub_->set_capacity(&context, message, &e);
+    grpc::Status status = stub_->set_capacity(&context, message, &response);
 
     if (!status.ok()) {
         throw std::runtime_error(status.error_message());
     }
+
+    handle = response.handle();
 }
 
 Bucket ServerStorage::ReadBucket(const int& position)
 {
-    if (position >= this->capacity || position < 0) {
-        throw std::runtime_error(
-            "You are trying to access Bucket " + to_string(position) + ", but this Server contains only " + to_string(this->capacity) + " buckets.");
+    check_position(position);
+
+    auto iter = pending_buckets.find(position);
+    if (iter != pending_buckets.end()) {
+        return iter->second;
     }
 
-    grpc::ClientContext context;
     BucketReadResponse response;
     BucketReadMessage message;
-    message.set_is_odict(is_odict);
-    message.set_oram_id(oram_id);
     message.set_position(position);
-    message.set_map_key(key);
+    message.set_handle(handle);
 
-    grpc::Status status = stub_->read_bucket(&context, message, &response);
-    if (!status.ok()) {
-        throw std::runtime_error(status.error_message());
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_read_bucket()->Swap(&message);
+        response.Swap(call(request).mutable_read_bucket());
+    } else {
+        grpc::ClientContext context;
+        grpc::Status status = stub_->read_bucket(&context, message, &response);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
     }
 
-    return deserialize<Bucket>(response.buffer());
+    return Bucket(std::move(*response.mutable_buffer()), block_size);
 }
 
 void ServerStorage::WriteBucket(const int& position, const Bucket& bucket_to_write)
 {   
+    check_position(position);
+    wait_for({ position });
+
+    BucketWriteMessage message;
+    message.set_position(position);
+    message.set_buffer(bucket_to_write.getBuffer());
+    message.set_handle(handle);
+
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_write_bucket()->Swap(&message);
+        post(request);
+        return;
+    }
+
+    grpc::ClientContext context;
+    google::protobuf::Empty e;
+    grpc::Status status = stub_->write_bucket(&context, message, &e);
+    if (!status.ok()) {
+        throw std::runtime_error(status.error_message());
+    }
+}
+
+void ServerStorage::check_position(const int& position)
+{
     if (position >= this->capacity || position < 0) {
         throw std::runtime_error(
             "You are trying to access Bucket " + to_string(position) + ", but this Server contains only " + to_string(this->capacity) + " buckets.");
     }
+}
+
+void ServerStorage::check_path(const int& leaf, const int& start_level)
+{
+    if (leaf >= (1 << (num_levels - 1)) || leaf < 0) {
+        throw std::runtime_error(
+            "You are trying to access leaf " + to_string(leaf) + ", but this Server contains only " + to_string(1 << (num_levels - 1)) + " leaves.");
+    }
+    if (start_level < 0 || start_level > num_levels) {
+        throw std::runtime_error(
+            "You are trying to start from level " + to_string(start_level) + ", but this Server contains only " + to_string(num_levels) + " levels.");
+    }
+}
+
+std::vector<Bucket> ServerStorage::ReadPath(const int& leaf, const int& start_level)
+{
+    check_path(leaf, start_level);
+
+    std::vector<Bucket> buckets;
+    buckets.reserve(num_levels - start_level);
+    const int remote_level = start_level + pending_prefix(leaf, start_level);
+    for (int l = start_level; l < remote_level; l++) {
+        buckets.push_back(pending_buckets.at(get_bucket_position(leaf, l, num_levels)));
+    }
+    if (remote_level == num_levels) {
+        return buckets;
+    }
+
+    PathReadResponse response;
+    PathReadMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(remote_level);
+    message.set_handle(handle);
+
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_read_path()->Swap(&message);
+        response.Swap(call(request).mutable_read_path());
+    } else {
+        grpc::ClientContext context;
+        grpc::Status status = stub_->read_path(&context, message, &response);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
+    }
+
+    if (response.buckets_size() != num_levels - remote_level) {
+        throw std::runtime_error("The server returned a path of " + to_string(response.buckets_size()) + " buckets, but " + to_string(num_levels - remote_level) + " were requested.");
+    }
+
+    for (int i = 0; i < response.buckets_size(); i++) {
+        buckets.emplace_back(std::move(*response.mutable_buckets(i)), block_size);
+    }
+    return buckets;
+}
+
+void ServerStorage::WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+{
+    check_path(leaf, start_level);
+
+    PathWriteMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(start_level);
+    message.set_handle(handle);
+    for (const Bucket& bucket : buckets_to_write) {
+        message.add_buckets(bucket.getBuffer());
+    }
+
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_write_path()->Swap(&message);
+        post(request);
+        return;
+    }
+
+    if (async_write) {
+        std::vector<int> positions;
+        for (int l = start_level; l < num_levels; l++) {
+            positions.push_back(get_bucket_position(leaf, l, num_levels));
+        }
+
+        PendingWrite& write = begin_write(positions, buckets_to_write);
+        write.reader = stub_->Asyncwrite_path(&write.context, message, &cq);
+        write.reader->Finish(&write.reply, &write.status, &write);
+        return;
+    }
 
     grpc::ClientContext context;
-    BucketWriteMessage message;
     google::protobuf::Empty e;
-    message.set_is_odict(is_odict);
-    message.set_oram_id(oram_id);
-    message.set_position(position);
-    message.set_buffer(serialize<Bucket>(bucket_to_write));
-    message.set_map_key(key);
+    grpc::Status status = stub_->write_path(&context, message, &e);
+    if (!status.ok()) {
+        throw std::runtime_error(status.error_message());
+    }
+}
 
-    grpc::Status status = stub_->write_bucket(&context, message, &e);
+std::vector<Block> ServerStorage::ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level)
+{
+    check_path(leaf, start_level);
+
+    std::vector<Block> blocks;
+    blocks.reserve(offsets.size());
+    const int remote_level = start_level + pending_prefix(leaf, start_level);
+    for (int l = start_level; l < remote_level && l - start_level < (int)offsets.size(); l++) {
+        blocks.push_back(pending_buckets.at(get_bucket_position(leaf, l, num_levels)).getBlockAt(offsets[l - start_level]));
+    }
+    if (remote_level == num_levels) {
+        return blocks;
+    }
+
+    PathBlocksReadResponse response;
+    PathBlocksReadMessage message;
+    message.set_leaf(leaf);
+    message.set_start_level(remote_level);
+    message.set_handle(handle);
+    for (size_t i = remote_level - start_level; i < offsets.size(); i++) {
+        message.add_offsets(offsets[i]);
+    }
+
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_read_path_blocks()->Swap(&message);
+        response.Swap(call(request).mutable_read_path_blocks());
+    } else {
+        grpc::ClientContext context;
+        grpc::Status status = stub_->read_path_blocks(&context, message, &response);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
+    }
+
+    if (response.blocks_size() != message.offsets_size()) {
+        throw std::runtime_error("The server returned " + to_string(response.blocks_size()) + " blocks, but " + to_string(message.offsets_size()) + " were requested.");
+    }
+    for (int i = 0; i < response.blocks_size(); i++) {
+        const std::string& slot = response.blocks(i);
+        if (slot.size() != Block::slot_size(block_size)) {
+            throw std::runtime_error("The server returned a slot of " + to_string(slot.size()) + " bytes.");
+        }
+        blocks.push_back(Block::read_slot(slot.data(), block_size));
+    }
+    return blocks;
+}
+
+std::vector<Bucket> ServerStorage::ReadBuckets(const std::vector<int>& positions)
+{
+    BucketsReadMessage message;
+    message.set_handle(handle);
+    for (const int& position : positions) {
+        check_position(position);
+        if (pending_buckets.find(position) == pending_buckets.end()) {
+            message.add_positions(position);
+        }
+    }
+
+    BucketsReadResponse response;
+    const int requested = message.positions_size();
+    if (requested != 0 && use_session) {
+        SessionRequest request;
+        request.mutable_read_buckets()->Swap(&message);
+        response.Swap(call(request).mutable_read_buckets());
+    } else if (requested != 0) {
+        grpc::ClientContext context;
+        grpc::Status status = stub_->read_buckets(&context, message, &response);
+        if (!status.ok()) {
+            throw std::runtime_error(status.error_message());
+        }
+    }
+    if (response.buckets_size() != requested) {
+        throw std::runtime_error("The server returned " + to_string(response.buckets_size()) + " buckets, but " + to_string(requested) + " were requested.");
+    }
+
+    // Buckets that are still being written are served from the pending writes.
+    std::vector<Bucket> buckets;
+    buckets.reserve(positions.size());
+    int next = 0;
+    for (const int& position : positions) {
+        auto iter = pending_buckets.find(position);
+        if (iter != pending_buckets.end()) {
+            buckets.push_back(iter->second);
+        } else {
+            buckets.emplace_back(std::move(*response.mutable_buckets(next++)), block_size);
+        }
+    }
+    return buckets;
+}
+
+void ServerStorage::WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    if (positions.size() != buckets_to_write.size()) {
+        throw std::runtime_error("The number of buckets does not match the number of positions.");
+    }
+
+    BucketsWriteMessage message;
+    message.set_handle(handle);
+    for (size_t i = 0; i < positions.size(); i++) {
+        check_position(positions[i]);
+        message.add_positions(positions[i]);
+        message.add_buckets(buckets_to_write[i].getBuffer());
+    }
+
+    if (use_session) {
+        SessionRequest request;
+        request.mutable_write_buckets()->Swap(&message);
+        post(request);
+        return;
+    }
+
+    if (async_write) {
+        PendingWrite& write = begin_write(positions, buckets_to_write);
+        write.reader = stub_->Asyncwrite_buckets(&write.context, message, &cq);
+        write.reader->Finish(&write.reply, &write.status, &write);
+        return;
+    }
+
+    wait_for(positions);
+    grpc::ClientContext context;
+    google::protobuf::Empty e;
+    grpc::Status status = stub_->write_buckets(&context, message, &e);
     if (!status.ok()) {
         throw std::runtime_error(status.error_message());
     }
-}
\ No newline at end of file
+}
+
+uint64_t ServerStorage::get_handle() const
+{
+    return handle;
+}
+
+bool ServerStorage::is_vectored()
+{
+    return true;
+}
+
+void ServerStorage::add_read(VectoredMessage& message, const std::vector<int>& positions)
+{
+    // The vectored call bypasses the asynchronous writes and the session, so they have to land first.
+    flush();
+
+    BucketsReadMessage* read = message.add_reads();
+    read->set_handle(handle);
+    for (const int& position : positions) {
+        check_position(position);
+        read->add_positions(position);
+    }
+}
+
+std::vector<Bucket> ServerStorage::take_read(BucketsReadResponse& response, const std::vector<int>& positions)
+{
+    if (response.buckets_size() != (int)positions.size()) {
+        throw std::runtime_error("The server returned " + to_string(response.buckets_size()) + " buckets, but " + to_string(positions.size()) + " were requested.");
+    }
+
+    std::vector<Bucket> buckets;
+    buckets.reserve(positions.size());
+    for (int i = 0; i < response.buckets_size(); i++) {
+        buckets.emplace_back(std::move(*response.mutable_buckets(i)), block_size);
+    }
+    return buckets;
+}
+
+void ServerStorage::add_write(
+    VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    if (positions.size() != buckets_to_write.size()) {
+        throw std::runtime_error("The number of buckets does not match the number of positions.");
+    }
+    flush();
+
+    BucketsWriteMessage* write = message.add_writes();
+    write->set_handle(handle);
+    for (size_t i = 0; i < positions.size(); i++) {
+        check_position(positions[i]);
+        write->add_positions(positions[i]);
+        write->add_buckets(buckets_to_write[i].getBuffer());
+    }
+}
+
+void ServerStorage::LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write)
+{
+    if (first_position < 0 || first_position + (int)buckets_to_write.size() > this->capacity) {
+        throw std::runtime_error(
+            "You are trying to load Buckets " + to_string(first_position) + " to " + to_string(first_position + buckets_to_write.size()) + ", but this Server contains only " + to_string(this->capacity) + " buckets.");
+    }
+
+    flush();
+
+    grpc::ClientContext context;
+    google::protobuf::Empty e;
+    std::unique_ptr<grpc::ClientWriter<BucketsWriteMessage>> writer(stub_->load_buckets(&context, &e));
+
+    size_t i = 0;
+    while (i < buckets_to_write.size()) {
+        BucketsWriteMessage message;
+        message.set_handle(handle);
+
+        size_t chunk_size = 0;
+        for (; i < buckets_to_write.size() && chunk_size < LOAD_CHUNK_SIZE; i++) {
+            message.add_positions(first_position + i);
+            message.add_buckets(buckets_to_write[i].getBuffer());
+            chunk_size += message.buckets(message.buckets_size() - 1).size();
+        }
+
+        if (!writer->Write(message)) {
+            // The stream is broken; the reason is reported by Finish.
+            break;
+        }
+    }
+
+    writer->WritesDone();
+    grpc::Status status = writer->Finish();
+    if (!status.ok()) {
+        throw std::runtime_error(status.error_message());
+    }
+}
+
+void ServerStorage::flush()
+{
+    while (!pending_writes.empty()) {
+        complete_write(true);
+    }
+
+    SessionResponse response;
+    while (unanswered != 0) {
+        receive(response);
+    }
+}
+
+bool ServerStorage::complete_write(const bool& wait)
+{
+    if (pending_writes.empty()) {
+        return false;
+    }
+
+    void* tag;
+    bool ok;
+    if (wait) {
+        if (!cq.Next(&tag, &ok)) {
+            throw std::runtime_error("The completion queue of the server storage has been shut down.");
+        }
+    } else if (cq.AsyncNext(&tag, &ok, std::chrono::system_clock::now()) != grpc::CompletionQueue::GOT_EVENT) {
+        return false;
+    }
+
+    for (auto iter = pending_writes.begin(); iter != pending_writes.end(); iter++) {
+        if (&(*iter) == tag) {
+            for (const int& position : iter->positions) {
+                pending_buckets.erase(position);
+            }
+            const grpc::Status status = iter->status;
+            pending_writes.erase(iter);
+
+            if (!ok || !status.ok()) {
+                throw std::runtime_error("An asynchronous path write failed: " + status.error_message());
+            }
+            return true;
+        }
+    }
+
+    throw std::runtime_error("The server storage received an unknown completion.");
+}
+
+ServerStorage::PendingWrite&
+ServerStorage::begin_write(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    // Reap the finished writes and keep at most one write in flight for every bucket, since the server
+    // may apply two concurrent writes in any order.
+    while (complete_write(false)) {
+    }
+    wait_for(positions);
+
+    pending_writes.emplace_back();
+    PendingWrite& write = pending_writes.back();
+    for (size_t i = 0; i < positions.size() && i < buckets_to_write.size(); i++) {
+        pending_buckets[positions[i]] = buckets_to_write[i];
+    }
+    write.positions = positions;
+    return write;
+}
+
+void ServerStorage::wait_for(const std::vector<int>& positions)
+{
+    for (const int& position : positions) {
+        while (pending_buckets.find(position) != pending_buckets.end()) {
+            complete_write(true);
+        }
+    }
+}
+
+int ServerStorage::pending_prefix(const int& leaf, const int& start_level)
+{
+    if (pending_buckets.empty()) {
+        return 0;
+    }
+
+    int prefix = 0;
+    while (start_level + prefix < num_levels
+        && pending_buckets.find(get_bucket_position(leaf, start_level + prefix, num_levels)) != pending_buckets.end()) {
+        prefix++;
+    }
+    for (int l = start_level + prefix; l < num_levels; l++) {
+        if (pending_buckets.find(get_bucket_position(leaf, l, num_levels)) != pending_buckets.end()) {
+            flush();
+            return 0;
+        }
+    }
+    return prefix;
+}
+
+void ServerStorage::post(const SessionRequest& request)
+{
+    if (session == nullptr) {
+        session_context.reset(new grpc::ClientContext());
+        session = stub_->oram_session(session_context.get());
+    }
+
+    if (!session->Write(request)) {
+        // The stream is broken; the reason is reported by Finish.
+        const grpc::Status status = close_session();
+        throw std::runtime_error("The ORAM session is closed: " + status.error_message());
+    }
+    unanswered++;
+}
+
+SessionResponse ServerStorage::call(const SessionRequest& request)
+{
+    post(request);
+
+    SessionResponse response;
+    while (unanswered != 0) {
+        receive(response);
+    }
+    return response;
+}
+
+void ServerStorage::receive(SessionResponse& response)
+{
+    if (!session->Read(&response)) {
+        const grpc::Status status = close_session();
+        throw std::runtime_error("The ORAM session is closed: " + status.error_message());
+    }
+
+    unanswered--;
+    if (response.code() != grpc::OK) {
+        throw std::runtime_error(response.error_message());
+    }
+}
+
+grpc::Status ServerStorage::close_session()
+{
+    session->WritesDone();
+    SessionResponse response;
+    while (session->Read(&response)) {
+    }
+    const grpc::Status status = session->Finish();
+
+    session.reset();
+    session_context.reset();
+    unanswered = 0;
+    return status;
+}
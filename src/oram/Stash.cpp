@@ -0,0 +1,195 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/Stash.h>
+#include <utils.h>
+
+#include <stdexcept>
+#include <string>
+
+Block* Stash::find(const int& block_index)
+{
+    auto iter = slots.find(block_index);
+    return iter == slots.end() ? nullptr : &blocks[iter->second];
+}
+
+void Stash::add(Block&& block)
+{
+    auto iter = slots.find(block.index);
+    if (iter != slots.end()) {
+        blocks[iter->second] = std::move(block);
+    } else {
+        slots[block.index] = blocks.size();
+        blocks.push_back(std::move(block));
+    }
+}
+
+bool Stash::remove(const int& block_index)
+{
+    auto iter = slots.find(block_index);
+    if (iter == slots.end()) {
+        return false;
+    }
+
+    // Swap the last block into the hole so that the array stays dense.
+    const size_t slot = iter->second;
+    slots.erase(iter);
+    if (slot != blocks.size() - 1) {
+        blocks[slot] = std::move(blocks.back());
+        slots[blocks[slot].index] = slot;
+    }
+    blocks.pop_back();
+    return true;
+}
+
+std::vector<Bucket> Stash::evict(
+    const int& leaf, const unsigned int& num_levels, const unsigned int& bucket_size, const unsigned int& block_size)
+{
+    // A leaf outside the tree would be filed under no level of the path, so nothing is moved before all are checked.
+    const int num_leaves = 1 << (num_levels - 1);
+    if (leaf < 0 || leaf >= num_leaves) {
+        throw std::out_of_range("Cannot evict onto the path to leaf " + std::to_string(leaf) + ", which is not in the tree.");
+    }
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if (blocks[i].leaf_id < 0 || blocks[i].leaf_id >= num_leaves) {
+            throw std::out_of_range("Block " + std::to_string(blocks[i].index) + " is mapped to leaf "
+                + std::to_string(blocks[i].leaf_id) + ", which is not in the tree.");
+        }
+    }
+
+    // candidates[l] holds the slots of the blocks that can go no deeper than level l on this path.
+    std::vector<std::vector<size_t>> candidates(num_levels);
+    for (size_t i = 0; i < blocks.size(); i++) {
+        const int level = common_level(blocks[i].leaf_id, leaf, num_levels);
+        candidates[level].push_back(i);
+    }
+
+    std::vector<Bucket> path(num_levels);
+    std::vector<bool> evicted(blocks.size(), false);
+    std::vector<size_t> pending;
+    for (int l = num_levels - 1; l >= 0; l--) {
+        // Blocks that did not fit in a deeper bucket may still be placed here.
+        pending.insert(pending.end(), candidates[l].begin(), candidates[l].end());
+
+        std::vector<Block> bucket_blocks;
+        bucket_blocks.reserve(bucket_size);
+        while (bucket_blocks.size() < bucket_size && !pending.empty()) {
+            const size_t slot = pending.back();
+            pending.pop_back();
+            bucket_blocks.push_back(std::move(blocks[slot]));
+            evicted[slot] = true;
+        }
+        while (bucket_blocks.size() < bucket_size) {
+            bucket_blocks.emplace_back(); //dummy block
+        }
+        path[l] = Bucket(bucket_blocks, block_size);
+    }
+
+    compact(evicted);
+
+    return path;
+}
+
+std::vector<Bucket> Stash::evict_buckets(
+    const std::vector<int>& positions, const unsigned int& num_levels, const unsigned int& bucket_size,
+    const unsigned int& block_size)
+{
+    std::unordered_map<int, size_t> offsets;
+    for (size_t i = 0; i < positions.size(); i++) {
+        offsets[positions[i]] = i;
+    }
+
+    // candidates[i] holds the slots of the blocks whose deepest reachable bucket in the union is positions[i].
+    std::vector<std::vector<size_t>> candidates(positions.size());
+    for (size_t i = 0; i < blocks.size(); i++) {
+        for (int l = num_levels - 1; l >= 0; l--) {
+            auto iter = offsets.find(get_bucket_position(blocks[i].leaf_id, l, num_levels));
+            if (iter != offsets.end()) {
+                candidates[iter->second].push_back(i);
+                break;
+            }
+        }
+    }
+
+    // A child always comes after its parent in heap order, so walking backwards fills the deepest buckets first.
+    std::vector<Bucket> buckets(positions.size());
+    std::vector<bool> evicted(blocks.size(), false);
+    for (int i = positions.size() - 1; i >= 0; i--) {
+        std::vector<size_t>& pending = candidates[i];
+
+        std::vector<Block> bucket_blocks;
+        bucket_blocks.reserve(bucket_size);
+        while (bucket_blocks.size() < bucket_size && !pending.empty()) {
+            const size_t slot = pending.back();
+            pending.pop_back();
+            bucket_blocks.push_back(std::move(blocks[slot]));
+            evicted[slot] = true;
+        }
+        while (bucket_blocks.size() < bucket_size) {
+            bucket_blocks.emplace_back(); //dummy block
+        }
+        buckets[i] = Bucket(bucket_blocks, block_size);
+
+        // Blocks that did not fit may still be placed in the parent, which is in the union as well.
+        if (positions[i] > 0 && !pending.empty()) {
+            std::vector<size_t>& parent = candidates[offsets.at((positions[i] - 1) / 2)];
+            parent.insert(parent.end(), pending.begin(), pending.end());
+        }
+    }
+
+    compact(evicted);
+
+    return buckets;
+}
+
+void Stash::compact(const std::vector<bool>& evicted)
+{
+    size_t kept = 0;
+    slots.clear();
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if (!evicted[i]) {
+            if (kept != i) {
+                blocks[kept] = std::move(blocks[i]);
+            }
+            slots[blocks[kept].index] = kept;
+            kept++;
+        }
+    }
+    blocks.resize(kept);
+}
+
+const std::vector<Block>& Stash::get_blocks()
+{
+    return blocks;
+}
+
+size_t Stash::size()
+{
+    return blocks.size();
+}
+
+int Stash::common_level(const int& lhs, const int& rhs, const unsigned int& num_levels)
+{
+    const unsigned int diff = (unsigned int)(lhs ^ rhs);
+    if (diff == 0) {
+        return num_levels - 1;
+    }
+
+    // The paths diverge right below the highest differing bit of the leaf labels.
+    int highest_bit = 31 - __builtin_clz(diff);
+    return (int)num_levels - 2 - highest_bit;
+}
@@ -0,0 +1,227 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/TreeTopCacheStorage.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+TreeTopCacheStorage::TreeTopCacheStorage(UntrustedStorageInterface* storage, const int& cached_levels)
+    : storage(storage)
+    , max_cached_levels(cached_levels)
+    , cached_levels(0)
+    , num_levels(0)
+{
+    if (cached_levels < 0) {
+        throw std::runtime_error("The number of cached levels cannot be negative.");
+    }
+}
+
+TreeTopCacheStorage::~TreeTopCacheStorage()
+{
+    delete storage;
+}
+
+bool TreeTopCacheStorage::is_cached(const int& position)
+{
+    return position >= 0 && position < (int)top.size();
+}
+
+void TreeTopCacheStorage::setCapacity(const int& total_number_of_buckets, const int& slots_per_bucket, const int& block_size)
+{
+    storage->setCapacity(total_number_of_buckets, slots_per_bucket, block_size);
+
+    num_levels = get_num_levels(total_number_of_buckets);
+    cached_levels = std::min(max_cached_levels, num_levels);
+    top.assign(std::min((1 << cached_levels) - 1, total_number_of_buckets), Bucket(slots_per_bucket, block_size));
+}
+
+Bucket TreeTopCacheStorage::ReadBucket(const int& position)
+{
+    return is_cached(position) ? top[position] : storage->ReadBucket(position);
+}
+
+void TreeTopCacheStorage::WriteBucket(const int& position, const Bucket& bucket_to_write)
+{
+    if (is_cached(position)) {
+        top[position] = bucket_to_write;
+    } else {
+        storage->WriteBucket(position, bucket_to_write);
+    }
+}
+
+std::vector<Bucket> TreeTopCacheStorage::ReadPath(const int& leaf, const int& start_level)
+{
+    std::vector<Bucket> buckets;
+    buckets.reserve(num_levels - start_level);
+    for (int l = start_level; l < cached_levels; l++) {
+        buckets.push_back(top[get_bucket_position(leaf, l, num_levels)]);
+    }
+
+    const int remote_level = std::max(start_level, cached_levels);
+    if (remote_level < num_levels) {
+        std::vector<Bucket> remote = storage->ReadPath(leaf, remote_level);
+        std::move(remote.begin(), remote.end(), std::back_inserter(buckets));
+    }
+    return buckets;
+}
+
+void TreeTopCacheStorage::WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+{
+    if ((int)buckets_to_write.size() != num_levels - start_level) {
+        throw std::runtime_error("The path does not match the height of the ORAM tree.");
+    }
+
+    for (int l = start_level; l < cached_levels; l++) {
+        top[get_bucket_position(leaf, l, num_levels)] = buckets_to_write[l - start_level];
+    }
+
+    const int remote_level = std::max(start_level, cached_levels);
+    if (remote_level < num_levels) {
+        std::vector<Bucket> remote(buckets_to_write.begin() + (remote_level - start_level), buckets_to_write.end());
+        storage->WritePath(leaf, remote, remote_level);
+    }
+}
+
+std::vector<Block> TreeTopCacheStorage::ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level)
+{
+    if ((int)offsets.size() != num_levels - start_level) {
+        throw std::runtime_error("The offsets do not match the height of the ORAM tree.");
+    }
+
+    std::vector<Block> blocks;
+    blocks.reserve(offsets.size());
+    for (int l = start_level; l < cached_levels; l++) {
+        blocks.push_back(top[get_bucket_position(leaf, l, num_levels)].getBlockAt(offsets[l - start_level]));
+    }
+
+    const int remote_level = std::max(start_level, cached_levels);
+    if (remote_level < num_levels) {
+        std::vector<int> remote_offsets(offsets.begin() + (remote_level - start_level), offsets.end());
+        std::vector<Block> remote = storage->ReadBlocks(leaf, remote_offsets, remote_level);
+        std::move(remote.begin(), remote.end(), std::back_inserter(blocks));
+    }
+    return blocks;
+}
+
+std::vector<int> TreeTopCacheStorage::remote_positions(const std::vector<int>& positions)
+{
+    std::vector<int> remote;
+    for (const int& position : positions) {
+        if (!is_cached(position)) {
+            remote.push_back(position);
+        }
+    }
+    return remote;
+}
+
+std::vector<Bucket> TreeTopCacheStorage::merge_remote(const std::vector<int>& positions, std::vector<Bucket>&& remote)
+{
+    std::vector<Bucket> buckets;
+    buckets.reserve(positions.size());
+    size_t next = 0;
+    for (const int& position : positions) {
+        buckets.push_back(is_cached(position) ? top[position] : std::move(remote.at(next++)));
+    }
+    return buckets;
+}
+
+std::vector<Bucket> TreeTopCacheStorage::write_cached(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    if (positions.size() != buckets_to_write.size()) {
+        throw std::runtime_error("The number of buckets does not match the number of positions.");
+    }
+
+    std::vector<Bucket> remote;
+    for (size_t i = 0; i < positions.size(); i++) {
+        if (is_cached(positions[i])) {
+            top[positions[i]] = buckets_to_write[i];
+        } else {
+            remote.push_back(buckets_to_write[i]);
+        }
+    }
+    return remote;
+}
+
+std::vector<Bucket> TreeTopCacheStorage::ReadBuckets(const std::vector<int>& positions)
+{
+    const std::vector<int> remote = remote_positions(positions);
+    return merge_remote(positions, remote.empty() ? std::vector<Bucket>() : storage->ReadBuckets(remote));
+}
+
+std::future<std::vector<Bucket>> TreeTopCacheStorage::ReadBucketsAsync(const std::vector<int>& positions)
+{
+    const std::vector<int> remote = remote_positions(positions);
+    std::future<std::vector<Bucket>> read = remote.empty() ? std::future<std::vector<Bucket>>() : storage->ReadBucketsAsync(remote);
+    return std::async(std::launch::deferred, [this, positions, read = std::move(read)]() mutable {
+        return merge_remote(positions, read.valid() ? read.get() : std::vector<Bucket>());
+    });
+}
+
+void TreeTopCacheStorage::WriteBuckets(const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    const std::vector<Bucket> remote = write_cached(positions, buckets_to_write);
+    if (!remote.empty()) {
+        storage->WriteBuckets(remote_positions(positions), remote);
+    }
+}
+
+void TreeTopCacheStorage::LoadBuckets(const int& first_position, const std::vector<Bucket>& buckets_to_write)
+{
+    const int end = first_position + buckets_to_write.size();
+    for (int position = std::max(first_position, 0); position < end && is_cached(position); position++) {
+        top[position] = buckets_to_write[position - first_position];
+    }
+
+    const int remote_position = std::max(first_position, (int)top.size());
+    if (remote_position < end) {
+        std::vector<Bucket> remote(buckets_to_write.begin() + (remote_position - first_position), buckets_to_write.end());
+        storage->LoadBuckets(remote_position, remote);
+    }
+}
+
+void TreeTopCacheStorage::flush()
+{
+    storage->flush();
+}
+
+bool TreeTopCacheStorage::is_vectored()
+{
+    return storage->is_vectored();
+}
+
+void TreeTopCacheStorage::add_read(VectoredMessage& message, const std::vector<int>& positions)
+{
+    // The read is added even if every bucket is cached, so that take_read always has its part of the response.
+    storage->add_read(message, remote_positions(positions));
+}
+
+std::vector<Bucket> TreeTopCacheStorage::take_read(BucketsReadResponse& response, const std::vector<int>& positions)
+{
+    return merge_remote(positions, storage->take_read(response, remote_positions(positions)));
+}
+
+void TreeTopCacheStorage::add_write(
+    VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+{
+    const std::vector<Bucket> remote = write_cached(positions, buckets_to_write);
+    if (!remote.empty()) {
+        storage->add_write(message, remote_positions(positions), remote);
+    }
+}
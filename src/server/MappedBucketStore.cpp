@@ -0,0 +1,333 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/Block.h>
+#include <plog/Log.h>
+#include <server/MappedBucketStore.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char TREE_MAGIC[8] = { 'S', 'E', 'A', 'L', 'T', 'R', 'E', 'E' };
+
+MappedBucketStore::MappedBucketStore(
+    const std::string& path, const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+    const std::string& label, const SyncPolicy& sync_policy,
+    const size_t& subtree_levels, const size_t& cached_levels)
+    : mapping(nullptr)
+    , pinned_size(0)
+    , num_buckets(num_buckets)
+    , slots_per_bucket(slots_per_bucket)
+    , slot_size(Block::slot_size(block_size))
+    , subtree_levels(subtree_levels)
+    , label(label)
+    , sync_policy(sync_policy)
+{
+    if (sizeof(TreeFileHeader) + label.size() > TREE_HEADER_SIZE) {
+        throw std::invalid_argument("The label of the tree does not fit in the header of the file.");
+    }
+    if (subtree_levels >= 32) {
+        throw std::invalid_argument("A subtree cannot have " + std::to_string(subtree_levels) + " levels.");
+    }
+    mapping_size = TREE_HEADER_SIZE + plan_layout();
+
+    const std::string temporary_path = path + ".tmp";
+    map(temporary_path, O_RDWR | O_CREAT | O_TRUNC);
+
+    try {
+        initialize(block_size);
+    } catch (...) {
+        munmap(mapping, mapping_size);
+        throw;
+    }
+
+    if (rename(temporary_path.c_str(), path.c_str()) != 0) {
+        munmap(mapping, mapping_size);
+        throw std::system_error(errno, std::generic_category(), "Cannot rename " + temporary_path);
+    }
+
+    pin_levels(cached_levels);
+}
+
+void MappedBucketStore::initialize(const size_t& block_size)
+{
+    TreeFileHeader header;
+    memcpy(header.magic, TREE_MAGIC, sizeof(TREE_MAGIC));
+    header.num_buckets = num_buckets;
+    header.slots_per_bucket = slots_per_bucket;
+    header.block_size = block_size;
+    header.subtree_levels = subtree_levels;
+    header.label_size = label.size();
+    memcpy(mapping, &header, sizeof(header));
+    memcpy(mapping + sizeof(header), label.data(), label.size());
+
+    const Block dummy;
+    for (size_t i = 0; i < num_buckets; i++) {
+        for (size_t j = 0; j < slots_per_bucket; j++) {
+            dummy.write_slot(bucket_at(i) + j * slot_size, block_size);
+        }
+    }
+
+    if (sync_policy != SYNC_NONE) {
+        sync();
+    }
+}
+
+MappedBucketStore::MappedBucketStore(const std::string& path, const SyncPolicy& sync_policy, const size_t& cached_levels)
+    : mapping(nullptr)
+    , mapping_size(0)
+    , pinned_size(0)
+    , sync_policy(sync_policy)
+{
+    map(path, O_RDWR);
+
+    try {
+        read_header(path);
+    } catch (...) {
+        munmap(mapping, mapping_size);
+        throw;
+    }
+
+    pin_levels(cached_levels);
+}
+
+void MappedBucketStore::read_header(const std::string& path)
+{
+    TreeFileHeader header;
+    if (mapping_size < TREE_HEADER_SIZE) {
+        throw std::runtime_error(path + " is not a tree file.");
+    }
+    memcpy(&header, mapping, sizeof(header));
+    if (memcmp(header.magic, TREE_MAGIC, sizeof(TREE_MAGIC)) != 0 || sizeof(header) + header.label_size > TREE_HEADER_SIZE
+        || header.subtree_levels >= 32) {
+        throw std::runtime_error(path + " is not a tree file.");
+    }
+
+    num_buckets = header.num_buckets;
+    slots_per_bucket = header.slots_per_bucket;
+    slot_size = Block::slot_size(header.block_size);
+    subtree_levels = header.subtree_levels;
+    label.assign(mapping + sizeof(header), header.label_size);
+
+    if (mapping_size != TREE_HEADER_SIZE + plan_layout()) {
+        throw std::runtime_error(path + " does not have the size of its tree.");
+    }
+}
+
+void MappedBucketStore::map(const std::string& path, const int& flags)
+{
+    const int fd = open(path.c_str(), flags, 0600);
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+    }
+
+    if (flags & O_CREAT) {
+        // Reserve the blocks up front, so that a full disk is reported now rather than as a SIGBUS later.
+        const int error = posix_fallocate(fd, 0, mapping_size);
+        if (error != 0 && (error != EOPNOTSUPP || ftruncate(fd, mapping_size) != 0)) {
+            close(fd);
+            throw std::system_error(error, std::generic_category(), "Cannot allocate " + path);
+        }
+    } else {
+        struct stat status;
+        if (fstat(fd, &status) != 0) {
+            close(fd);
+            throw std::system_error(errno, std::generic_category(), "Cannot stat " + path);
+        }
+        mapping_size = status.st_size;
+    }
+
+    void* result = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps the file open.
+    close(fd);
+    if (result == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "Cannot map " + path);
+    }
+    mapping = static_cast<char*>(result);
+}
+
+MappedBucketStore::~MappedBucketStore()
+{
+    if (mapping != nullptr) {
+        munmap(mapping, mapping_size);
+    }
+}
+
+const std::string& MappedBucketStore::get_label() const
+{
+    return label;
+}
+
+size_t MappedBucketStore::size() const
+{
+    return num_buckets;
+}
+
+size_t MappedBucketStore::num_slots() const
+{
+    return slots_per_bucket;
+}
+
+size_t MappedBucketStore::block_size() const
+{
+    return slot_size - sizeof(SlotHeader);
+}
+
+size_t MappedBucketStore::bucket_size() const
+{
+    return slots_per_bucket * slot_size;
+}
+
+size_t MappedBucketStore::memory_size() const
+{
+    return pinned_size;
+}
+
+size_t MappedBucketStore::disk_size() const
+{
+    return mapping_size;
+}
+
+void MappedBucketStore::check_position(const size_t& position) const
+{
+    if (position >= num_buckets) {
+        throw std::out_of_range(
+            "Bucket " + std::to_string(position) + " is out of the ORAM tree of " + std::to_string(num_buckets) + " buckets.");
+    }
+}
+
+size_t MappedBucketStore::plan_layout()
+{
+    band_offsets.clear();
+    extent_sizes.clear();
+    if (subtree_levels == 0) {
+        return num_buckets * bucket_size();
+    }
+
+    const size_t num_levels = get_num_levels(num_buckets);
+    size_t offset = 0;
+    for (size_t level = 0; level < num_levels; level += subtree_levels) {
+        const size_t levels = std::min(subtree_levels, num_levels - level);
+        const size_t extent = (((1UL << levels) - 1) * bucket_size() + TREE_EXTENT_ALIGNMENT - 1)
+            / TREE_EXTENT_ALIGNMENT * TREE_EXTENT_ALIGNMENT;
+
+        band_offsets.push_back(offset);
+        extent_sizes.push_back(extent);
+        offset += (1UL << level) * extent;
+    }
+    band_offsets.push_back(offset);
+
+    return offset;
+}
+
+void MappedBucketStore::pin_levels(const size_t& levels)
+{
+    size_t end = 0;
+    if (subtree_levels == 0) {
+        end = std::min((1UL << std::min(levels, 63UL)) - 1, num_buckets) * bucket_size();
+    } else {
+        const size_t bands = std::min((levels + subtree_levels - 1) / subtree_levels, extent_sizes.size());
+        end = band_offsets[bands];
+    }
+
+    char* const buckets = mapping + TREE_HEADER_SIZE;
+    const size_t buckets_size = mapping_size - TREE_HEADER_SIZE;
+    if (end > 0) {
+        madvise(buckets, end, MADV_WILLNEED);
+        if (mlock(buckets, end) == 0) {
+            pinned_size = end;
+        } else {
+            // The top of the tree then stays in the page cache only as long as it is hot.
+            PLOG(plog::warning) << "Cannot lock the top of the tree in memory: " << strerror(errno);
+        }
+    }
+
+    // Every access goes down a random path, so reading ahead of a fault only wastes I/O.
+    const size_t rest = end / TREE_EXTENT_ALIGNMENT * TREE_EXTENT_ALIGNMENT;
+    if (rest < buckets_size) {
+        madvise(buckets + rest, buckets_size - rest, MADV_RANDOM);
+    }
+}
+
+char* MappedBucketStore::bucket_at(const size_t& position) const
+{
+    if (subtree_levels == 0) {
+        return mapping + TREE_HEADER_SIZE + position * bucket_size();
+    }
+
+    const size_t level = 63 - __builtin_clzl(position + 1);
+    const size_t band = level / subtree_levels;
+    const size_t depth = level - band * subtree_levels;
+    // The root of the subtree is the ancestor of the bucket at the top level of the band.
+    const size_t root = ((position + 1) >> depth) - 1;
+    const size_t subtree = root - ((1UL << (band * subtree_levels)) - 1);
+    const size_t local = (1UL << depth) - 1 + (position + 1) - ((root + 1) << depth);
+
+    return mapping + TREE_HEADER_SIZE + band_offsets[band] + subtree * extent_sizes[band] + local * bucket_size();
+}
+
+void MappedBucketStore::read(const size_t& position, char* destination) const
+{
+    check_position(position);
+    memcpy(destination, bucket_at(position), bucket_size());
+}
+
+void MappedBucketStore::read_slot(const size_t& position, const size_t& offset, char* destination) const
+{
+    check_position(position);
+    if (offset >= slots_per_bucket) {
+        throw std::out_of_range("the slot " + std::to_string(offset) + " is not in the bucket.");
+    }
+    memcpy(destination, bucket_at(position) + offset * slot_size, slot_size);
+}
+
+void MappedBucketStore::write(const size_t& position, std::string_view bucket)
+{
+    check_position(position);
+    if (bucket.size() != bucket_size()) {
+        throw std::invalid_argument(
+            "The bucket has " + std::to_string(bucket.size()) + " bytes, but a bucket of this ORAM has " + std::to_string(bucket_size()) + " bytes.");
+    }
+    memcpy(bucket_at(position), bucket.data(), bucket.size());
+
+    if (sync_policy == SYNC_WRITE) {
+        // msync works on whole pages.
+        static const size_t page_size = sysconf(_SC_PAGESIZE);
+        const size_t begin = (bucket_at(position) - mapping) / page_size * page_size;
+        const size_t end = bucket_at(position) - mapping + bucket.size();
+        if (msync(mapping + begin, end - begin, MS_SYNC) != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot flush the bucket");
+        }
+    }
+}
+
+void MappedBucketStore::sync()
+{
+    if (msync(mapping, mapping_size, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "Cannot flush the tree");
+    }
+}
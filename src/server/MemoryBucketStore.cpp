@@ -0,0 +1,169 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/Block.h>
+#include <server/MemoryBucketStore.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <sys/mman.h>
+
+/**
+ * @brief The size of a huge page on x86-64, to which explicit huge page mappings are rounded.
+ */
+#define HUGE_PAGE_SIZE (2UL << 20)
+
+MemoryBucketStore::MemoryBucketStore(
+    const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+    const bool& huge_pages)
+    : arena(nullptr)
+    , arena_size(mapping_size(num_buckets, slots_per_bucket, block_size, huge_pages))
+    , num_buckets(num_buckets)
+    , slots_per_bucket(slots_per_bucket)
+    , slot_size(Block::slot_size(block_size))
+    , dirty(num_buckets, true)
+    , saved(false)
+{
+    if (arena_size == 0) {
+        return;
+    }
+
+    void* mapping = MAP_FAILED;
+    if (huge_pages) {
+        mapping = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+    if (mapping == MAP_FAILED) {
+        mapping = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        if (huge_pages) {
+            // Only a hint: the arena still works on regular pages if transparent huge pages are disabled.
+            madvise(mapping, arena_size, MADV_HUGEPAGE);
+        }
+    }
+    arena = static_cast<char*>(mapping);
+
+    // Every slot starts as a dummy, so that an unwritten bucket is still a valid one.
+    const Block dummy;
+    for (size_t i = 0; i < num_buckets * slots_per_bucket; i++) {
+        dummy.write_slot(arena + i * slot_size, block_size);
+    }
+}
+
+size_t MemoryBucketStore::mapping_size(
+    const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size, const bool& huge_pages)
+{
+    const size_t size = num_buckets * slots_per_bucket * Block::slot_size(block_size);
+    // The rounded size is kept on regular pages too, where it is what transparent huge pages may back anyway.
+    return huge_pages ? (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE : size;
+}
+
+MemoryBucketStore::~MemoryBucketStore()
+{
+    if (arena != nullptr) {
+        munmap(arena, arena_size);
+    }
+}
+
+size_t MemoryBucketStore::size() const
+{
+    return num_buckets;
+}
+
+size_t MemoryBucketStore::num_slots() const
+{
+    return slots_per_bucket;
+}
+
+size_t MemoryBucketStore::block_size() const
+{
+    return slot_size - sizeof(SlotHeader);
+}
+
+size_t MemoryBucketStore::bucket_size() const
+{
+    return slots_per_bucket * slot_size;
+}
+
+size_t MemoryBucketStore::memory_size() const
+{
+    return arena_size;
+}
+
+size_t MemoryBucketStore::disk_size() const
+{
+    return 0;
+}
+
+void MemoryBucketStore::check_position(const size_t& position) const
+{
+    if (position >= num_buckets) {
+        throw std::out_of_range(
+            "Bucket " + std::to_string(position) + " is out of the ORAM tree of " + std::to_string(num_buckets) + " buckets.");
+    }
+}
+
+void MemoryBucketStore::read(const size_t& position, char* destination) const
+{
+    check_position(position);
+    memcpy(destination, arena + position * bucket_size(), bucket_size());
+}
+
+void MemoryBucketStore::read_slot(const size_t& position, const size_t& offset, char* destination) const
+{
+    check_position(position);
+    if (offset >= slots_per_bucket) {
+        throw std::out_of_range("the slot " + std::to_string(offset) + " is not in the bucket.");
+    }
+    memcpy(destination, arena + position * bucket_size() + offset * slot_size, slot_size);
+}
+
+void MemoryBucketStore::write(const size_t& position, std::string_view bucket)
+{
+    check_position(position);
+    if (bucket.size() != bucket_size()) {
+        throw std::invalid_argument(
+            "The bucket has " + std::to_string(bucket.size()) + " bytes, but a bucket of this ORAM has " + std::to_string(bucket_size()) + " bytes.");
+    }
+    memcpy(arena + position * bucket_size(), bucket.data(), bucket.size());
+    dirty[position] = true;
+}
+
+std::vector<size_t> MemoryBucketStore::take_dirty()
+{
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < num_buckets; i++) {
+        if (dirty[i]) {
+            positions.push_back(i);
+            dirty[i] = false;
+        }
+    }
+    return positions;
+}
+
+bool MemoryBucketStore::is_saved() const
+{
+    return saved;
+}
+
+void MemoryBucketStore::set_saved(const bool& saved)
+{
+    this->saved = saved;
+}
@@ -0,0 +1,356 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <plog/Log.h>
+#include <server/SealCallbackService.h>
+
+#include <stdexcept>
+
+/**
+ * @brief Run a handler, turning an exception that escapes it into an INTERNAL status.
+ *
+ * Nothing above a worker or a reactor catches it, so it would terminate the server otherwise, whereas the
+ * synchronous service answers the call with an error.
+ */
+static grpc::Status guarded(const std::function<grpc::Status()>& handler)
+{
+    try {
+        return handler();
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+}
+
+/**
+ * @brief Writes the chunks of a streamed tree one after another.
+ */
+class LoadBucketsReactor : public grpc::ServerReadReactor<BucketsWriteMessage> {
+private:
+    SealCallbackService& service;
+
+    BucketsWriteMessage message;
+
+public:
+    LoadBucketsReactor(SealCallbackService& service)
+        : service(service)
+    {
+        StartRead(&message);
+    }
+
+    void OnReadDone(bool ok) override
+    {
+        if (!ok) {
+            // The client has sent every chunk.
+            Finish(grpc::Status::OK);
+            return;
+        }
+
+        // A chunk fills many buckets at once, so it is written by a worker.
+        service.post([this]() {
+            const grpc::Status status = guarded([this]() { return service.core->load_buckets(&message); });
+            if (!status.ok()) {
+                Finish(status);
+                return;
+            }
+            StartRead(&message);
+        });
+    }
+
+    void OnDone() override
+    {
+        delete this;
+    }
+};
+
+/**
+ * @brief Answers the requests of an ORAM session in order, reading the next one once the last answer is sent.
+ */
+class OramSessionReactor : public grpc::ServerBidiReactor<SessionRequest, SessionResponse> {
+private:
+    SealCallbackService& service;
+
+    SessionRequest request;
+
+    SessionResponse response;
+
+    void answer()
+    {
+        // The session goes on after a failed request, which is answered with its error like any other.
+        response.Clear();
+        try {
+            service.core->oram_session(&request, &response);
+        } catch (const std::exception& e) {
+            PLOG_(1, plog::error) << e.what();
+            response.Clear();
+            response.set_code(grpc::INTERNAL);
+            response.set_error_message(e.what());
+        }
+        StartWrite(&response);
+    }
+
+public:
+    OramSessionReactor(SealCallbackService& service)
+        : service(service)
+    {
+        StartRead(&request);
+    }
+
+    void OnReadDone(bool ok) override
+    {
+        if (!ok) {
+            Finish(grpc::Status::OK);
+            return;
+        }
+
+        if (service.defer_buckets) {
+            service.post([this]() { answer(); });
+        } else {
+            answer();
+        }
+    }
+
+    void OnWriteDone(bool ok) override
+    {
+        if (!ok) {
+            Finish(grpc::Status(grpc::UNAVAILABLE, "The ORAM session is broken."));
+            return;
+        }
+        StartRead(&request);
+    }
+
+    void OnDone() override
+    {
+        delete this;
+    }
+};
+
+SealCallbackService::SealCallbackService(const StorageOptions& options, const size_t& workers)
+    : SealCallbackService(std::make_shared<SealCore>(options), workers)
+{
+}
+
+SealCallbackService::SealCallbackService(const std::shared_ptr<SealCore>& core, const size_t& workers)
+    : core(core)
+    , defer_buckets(core->buckets_on_disk())
+    , stopping(false)
+{
+    if (workers == 0) {
+        throw std::runtime_error("The callback service needs at least one worker.");
+    }
+
+    for (size_t i = 0; i < workers; i++) {
+        this->workers.emplace_back(&SealCallbackService::run_tasks, this);
+    }
+}
+
+SealCallbackService::~SealCallbackService()
+{
+    {
+        std::lock_guard<std::mutex> lock(task_lock);
+        stopping = true;
+    }
+    task_ready.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void SealCallbackService::run_tasks()
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(task_lock);
+            task_ready.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void SealCallbackService::post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(task_lock);
+        tasks.push_back(std::move(task));
+    }
+    task_ready.notify_one();
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::finish(grpc::CallbackServerContext* context, const grpc::Status& status)
+{
+    grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(status);
+    return reactor;
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::defer(grpc::CallbackServerContext* context, std::function<grpc::Status()> handler)
+{
+    grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+    post([reactor, handler]() { reactor->Finish(guarded(handler)); });
+    return reactor;
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::serve_buckets(grpc::CallbackServerContext* context, std::function<grpc::Status()> handler)
+{
+    return defer_buckets ? defer(context, std::move(handler)) : finish(context, guarded(handler));
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::setup(
+    grpc::CallbackServerContext* context,
+    const SetupMessage* message,
+    google::protobuf::Empty* e)
+{
+    return defer(context, [this, message, e]() { return core->setup(message, e); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::set_capacity(
+    grpc::CallbackServerContext* context,
+    const BucketSetMessage* message,
+    BucketSetResponse* response)
+{
+    return defer(context, [this, message, response]() { return core->set_capacity(message, response); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::read_bucket(
+    grpc::CallbackServerContext* context,
+    const BucketReadMessage* message,
+    BucketReadResponse* response)
+{
+    return serve_buckets(context, [this, message, response]() { return core->read_bucket(message, response); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::write_bucket(
+    grpc::CallbackServerContext* context,
+    const BucketWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    return serve_buckets(context, [this, message, e]() { return core->write_bucket(message, e); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::read_path(
+    grpc::CallbackServerContext* context,
+    const PathReadMessage* message,
+    PathReadResponse* response)
+{
+    return serve_buckets(context, [this, message, response]() { return core->read_path(message, response); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::write_path(
+    grpc::CallbackServerContext* context,
+    const PathWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    return serve_buckets(context, [this, message, e]() { return core->write_path(message, e); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::read_path_blocks(
+    grpc::CallbackServerContext* context,
+    const PathBlocksReadMessage* message,
+    PathBlocksReadResponse* response)
+{
+    return serve_buckets(context, [this, message, response]() { return core->read_path_blocks(message, response); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::read_buckets(
+    grpc::CallbackServerContext* context,
+    const BucketsReadMessage* message,
+    BucketsReadResponse* response)
+{
+    return serve_buckets(context, [this, message, response]() { return core->read_buckets(message, response); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::write_buckets(
+    grpc::CallbackServerContext* context,
+    const BucketsWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    return serve_buckets(context, [this, message, e]() { return core->write_buckets(message, e); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::vectored_access(
+    grpc::CallbackServerContext* context,
+    const VectoredMessage* message,
+    VectoredResponse* response)
+{
+    return serve_buckets(context, [this, message, response]() { return core->vectored_access(message, response); });
+}
+
+grpc::ServerReadReactor<BucketsWriteMessage>*
+SealCallbackService::load_buckets(
+    grpc::CallbackServerContext* context,
+    google::protobuf::Empty* e)
+{
+    return new LoadBucketsReactor(*this);
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::storage_info(
+    grpc::CallbackServerContext* context,
+    const StorageInfoMessage* message,
+    StorageInfoResponse* response)
+{
+    return finish(context, guarded([this, message, response]() { return core->storage_info(message, response); }));
+}
+
+grpc::ServerBidiReactor<SessionRequest, SessionResponse>*
+SealCallbackService::oram_session(grpc::CallbackServerContext* context)
+{
+    return new OramSessionReactor(*this);
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::insert_handler(
+    grpc::CallbackServerContext* context,
+    const InsertMessage* message,
+    google::protobuf::Empty* e)
+{
+    return defer(context, [this, message, e]() { return core->insert_handler(message, e); });
+}
+
+grpc::ServerUnaryReactor*
+SealCallbackService::select_handler(
+    grpc::CallbackServerContext* context,
+    const SelectMessage* message,
+    SelectResult* response)
+{
+    return defer(context, [this, message, response]() { return core->select_handler(message, response); });
+}
+
+bool SealCallbackService::checkpoint()
+{
+    return core->checkpoint();
+}
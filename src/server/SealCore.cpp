@@ -0,0 +1,841 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <client/Objects.h>
+#include <oram/OramReadPathEviction.h>
+#include <oram/RandomForOram.h>
+#include <oram/ServerStorage.h>
+#include <plog/Log.h>
+#include <server/MappedBucketStore.h>
+#include <server/MemoryBucketStore.h>
+#include <server/SealCore.h>
+#include <server/SnapshotDirectory.h>
+#include <server/TieredBucketStore.h>
+#include <utils.h>
+
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+
+/* get_bucket_position only shifts the leaf, so a leaf outside the tree would silently land on other buckets. */
+static bool is_leaf_in_tree(const int& leaf, const int& num_levels)
+{
+    return num_levels > 0 && leaf >= 0 && leaf < (1 << (num_levels - 1));
+}
+
+SealCore::SealCore(const StorageOptions& options)
+    : options(options)
+    , stopping(false)
+{
+    if (options.backend == TIERED_STORAGE) {
+        std::filesystem::create_directories(options.directory);
+    } else if (options.backend == MAPPED_STORAGE) {
+        restore_storage();
+
+        if (options.sync_policy == SYNC_PERIODIC) {
+            checkpoint_thread = std::thread(&SealCore::checkpoint_periodically, this, options.sync_interval);
+        }
+    } else if (!options.checkpoint_directory.empty()) {
+        snapshots = std::make_unique<SnapshotDirectory>(options.checkpoint_directory);
+        auto trees = snapshots->restore(options.huge_pages);
+        for (auto iter = trees.begin(); iter != trees.end(); iter++) {
+            register_tree(iter->first, iter->second.first, std::move(iter->second.second));
+        }
+        fill_handles();
+
+        if (options.checkpoint_interval != 0) {
+            checkpoint_thread = std::thread(&SealCore::checkpoint_periodically, this, options.checkpoint_interval);
+        }
+    }
+}
+
+SealCore::~SealCore()
+{
+    {
+        std::lock_guard<std::mutex> lock(stop_lock);
+        stopping = true;
+    }
+    stop_condition.notify_all();
+    if (checkpoint_thread.joinable()) {
+        checkpoint_thread.join();
+    }
+}
+
+grpc::Status
+SealCore::setup(
+    const SetupMessage* message,
+    google::protobuf::Empty* e)
+{
+    const std::string connection_info = message->connection_information();
+    const std::string table_name = message->table_name();
+    const int column_size = message->column_names_size();
+    std::vector<std::string> column_names;
+    for (int i = 0; i < column_size; i++) {
+        column_names.push_back(message->column_names(i));
+    }
+
+    std::lock_guard<std::mutex> lock(connector_lock);
+    try {
+        /* Create a new connector to the database. */
+        connector = std::make_unique<SEAL::Connector>(connection_info);
+        connector.get()->create_table_handler(table_name, column_names);
+    } catch (const pqxx::failure& e) {
+        // Also an unreachable database, which throws pqxx::broken_connection instead of an SQL error.
+        const std::string error_message = "The connection information is not correct.";
+        return grpc::Status(grpc::FAILED_PRECONDITION, error_message);
+    }
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::set_capacity(
+    const BucketSetMessage* message,
+    BucketSetResponse* response)
+{
+    std::cout << "The server is setting the capacity of oblivious ram!" << std::endl;
+    const unsigned int total_number_of_buckets = message->number_of_buckets();
+    const bool is_odict = message->is_odict();
+    const std::string map_key = message->map_key();
+
+    if (message->slots_per_bucket() <= 0 || message->block_size() < 0) {
+        const std::string error_message = "The geometry of the buckets is not correct!";
+        return grpc::Status(grpc::INVALID_ARGUMENT, error_message);
+    }
+
+    /* The calls are serialized, so that every tree is checked against the memory budget left by all others. */
+    std::lock_guard<std::mutex> capacity_guard(capacity_lock);
+
+    uint64_t handle;
+    try {
+        std::unique_lock<std::shared_mutex> lock(storage_lock);
+        handle = reserve_handle(is_odict, message->oram_id(), map_key);
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::FAILED_PRECONDITION, e.what());
+    }
+    if (is_odict == true) {
+        std::cout << map_key << std::endl;
+    }
+
+    /* Build the new store before taking the lock again so that other clients are not held up. */
+    std::shared_ptr<StorageEntry> new_storage = std::make_shared<StorageEntry>();
+    try {
+        new_storage->store = create_store(
+            handle, tree_label(is_odict, message->oram_id(), map_key),
+            total_number_of_buckets, message->slots_per_bucket(), message->block_size());
+    } catch (const std::invalid_argument& e) {
+        return grpc::Status(grpc::INVALID_ARGUMENT, e.what());
+    } catch (const std::exception& e) {
+        PLOG(plog::error) << e.what();
+        return grpc::Status(grpc::RESOURCE_EXHAUSTED, e.what());
+    }
+
+    std::unique_lock<std::shared_mutex> lock(storage_lock);
+    storage[handle] = std::move(new_storage);
+
+    response->set_handle(handle);
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::read_bucket(
+    const BucketReadMessage* message,
+    BucketReadResponse* response)
+{
+    //std::cout << "The server is reading the bucket!\n";
+
+    const unsigned int position = message->position();
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::shared_lock<std::shared_mutex> lock(entry->lock);
+        const BucketStoreInterface& storage = *entry->store;
+        std::string* buffer = response->mutable_buffer();
+        buffer->resize(storage.bucket_size());
+        storage.read(position, buffer->data());
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::write_bucket(
+    const BucketWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    const unsigned int position = message->position();
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::unique_lock<std::shared_mutex> lock(entry->lock);
+        entry->store->write(position, message->buffer());
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::invalid_argument& e) {
+        return grpc::Status(grpc::INVALID_ARGUMENT, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::read_path(
+    const PathReadMessage* message,
+    PathReadResponse* response)
+{
+    const int leaf = message->leaf();
+    const int start_level = message->start_level();
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::shared_lock<std::shared_mutex> lock(entry->lock);
+        const BucketStoreInterface& storage = *entry->store;
+        const int num_levels = get_num_levels(storage.size());
+
+        if (start_level < 0 || start_level > num_levels) {
+            return grpc::Status(grpc::OUT_OF_RANGE, "The start level is out of the ORAM tree!");
+        }
+        if (!is_leaf_in_tree(leaf, num_levels)) {
+            return grpc::Status(grpc::OUT_OF_RANGE, "The leaf is out of the ORAM tree!");
+        }
+
+        for (int i = start_level; i < num_levels; i++) {
+            std::string* bucket = response->add_buckets();
+            bucket->resize(storage.bucket_size());
+            storage.read(get_bucket_position(leaf, i, num_levels), bucket->data());
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::write_path(
+    const PathWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    const int leaf = message->leaf();
+    const int start_level = message->start_level();
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::unique_lock<std::shared_mutex> lock(entry->lock);
+        BucketStoreInterface& storage = *entry->store;
+        const int num_levels = get_num_levels(storage.size());
+
+        if (start_level < 0 || message->buckets_size() != num_levels - start_level) {
+            const std::string error_message = "The path does not match the height of the ORAM tree!";
+            return grpc::Status(grpc::INVALID_ARGUMENT, error_message);
+        }
+        if (!is_leaf_in_tree(leaf, num_levels)) {
+            return grpc::Status(grpc::OUT_OF_RANGE, "The leaf is out of the ORAM tree!");
+        }
+        // Check every bucket first, so that a bad one does not leave the path half written.
+        for (int i = 0; i < message->buckets_size(); i++) {
+            if (message->buckets(i).size() != storage.bucket_size()) {
+                return grpc::Status(grpc::INVALID_ARGUMENT, "The bucket size does not match the ORAM tree!");
+            }
+        }
+
+        for (int i = start_level; i < num_levels; i++) {
+            storage.write(get_bucket_position(leaf, i, num_levels), message->buckets(i - start_level));
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::invalid_argument& e) {
+        return grpc::Status(grpc::INVALID_ARGUMENT, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::read_path_blocks(
+    const PathBlocksReadMessage* message,
+    PathBlocksReadResponse* response)
+{
+    const int leaf = message->leaf();
+    const int start_level = message->start_level();
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::shared_lock<std::shared_mutex> lock(entry->lock);
+        const BucketStoreInterface& storage = *entry->store;
+        const int num_levels = get_num_levels(storage.size());
+
+        if (start_level < 0 || message->offsets_size() != num_levels - start_level) {
+            const std::string error_message = "The offsets do not match the height of the ORAM tree!";
+            return grpc::Status(grpc::INVALID_ARGUMENT, error_message);
+        }
+        if (!is_leaf_in_tree(leaf, num_levels)) {
+            return grpc::Status(grpc::OUT_OF_RANGE, "The leaf is out of the ORAM tree!");
+        }
+
+        for (int i = start_level; i < num_levels; i++) {
+            std::string* slot = response->add_blocks();
+            slot->resize(Block::slot_size(storage.block_size()));
+            storage.read_slot(get_bucket_position(leaf, i, num_levels), message->offsets(i - start_level), slot->data());
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::read_buckets(
+    const BucketsReadMessage* message,
+    BucketsReadResponse* response)
+{
+    const uint64_t handle = message->handle();
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::shared_lock<std::shared_mutex> lock(entry->lock);
+        const BucketStoreInterface& storage = *entry->store;
+
+        for (int i = 0; i < message->positions_size(); i++) {
+            std::string* bucket = response->add_buckets();
+            bucket->resize(storage.bucket_size());
+            storage.read(message->positions(i), bucket->data());
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::write_buckets(
+    const BucketsWriteMessage* message,
+    google::protobuf::Empty* e)
+{
+    const uint64_t handle = message->handle();
+
+    if (message->positions_size() != message->buckets_size()) {
+        const std::string error_message = "The number of buckets does not match the number of positions!";
+        return grpc::Status(grpc::INVALID_ARGUMENT, error_message);
+    }
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(handle);
+        std::unique_lock<std::shared_mutex> lock(entry->lock);
+        BucketStoreInterface& storage = *entry->store;
+
+        for (int i = 0; i < message->positions_size(); i++) {
+            storage.write(message->positions(i), message->buckets(i));
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::invalid_argument& e) {
+        return grpc::Status(grpc::INVALID_ARGUMENT, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::vectored_access(
+    const VectoredMessage* message,
+    VectoredResponse* response)
+{
+    google::protobuf::Empty e;
+    for (const BucketsWriteMessage& write : message->writes()) {
+        const grpc::Status status = write_buckets(&write, &e);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    for (const BucketsReadMessage& read : message->reads()) {
+        const grpc::Status status = read_buckets(&read, response->add_reads());
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::load_buckets(const BucketsWriteMessage* message)
+{
+    if (message->positions_size() != message->buckets_size()) {
+        const std::string error_message = "The number of buckets does not match the number of positions!";
+        return grpc::Status(grpc::INVALID_ARGUMENT, error_message);
+    }
+
+    try {
+        const std::shared_ptr<StorageEntry> entry = get_storage(message->handle());
+        std::unique_lock<std::shared_mutex> lock(entry->lock);
+        BucketStoreInterface& storage = *entry->store;
+
+        for (int i = 0; i < message->positions_size(); i++) {
+            storage.write(message->positions(i), message->buckets(i));
+        }
+    } catch (const std::out_of_range& e) {
+        return grpc::Status(grpc::OUT_OF_RANGE, e.what());
+    } catch (const std::invalid_argument& e) {
+        return grpc::Status(grpc::INVALID_ARGUMENT, e.what());
+    } catch (const std::system_error& e) {
+        return grpc::Status(grpc::DATA_LOSS, e.what());
+    } catch (const std::exception& e) {
+        PLOG_(1, plog::error) << e.what();
+        return grpc::Status(grpc::INTERNAL, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+void
+SealCore::oram_session(const SessionRequest* request, SessionResponse* response)
+{
+    google::protobuf::Empty e;
+
+    grpc::Status status;
+    switch (request->operation_case()) {
+    case SessionRequest::kReadBucket:
+        status = read_bucket(&request->read_bucket(), response->mutable_read_bucket());
+        break;
+    case SessionRequest::kWriteBucket:
+        status = write_bucket(&request->write_bucket(), &e);
+        break;
+    case SessionRequest::kReadPath:
+        status = read_path(&request->read_path(), response->mutable_read_path());
+        break;
+    case SessionRequest::kWritePath:
+        status = write_path(&request->write_path(), &e);
+        break;
+    case SessionRequest::kReadPathBlocks:
+        status = read_path_blocks(&request->read_path_blocks(), response->mutable_read_path_blocks());
+        break;
+    case SessionRequest::kReadBuckets:
+        status = read_buckets(&request->read_buckets(), response->mutable_read_buckets());
+        break;
+    case SessionRequest::kWriteBuckets:
+        status = write_buckets(&request->write_buckets(), &e);
+        break;
+    default:
+        status = grpc::Status(grpc::INVALID_ARGUMENT, "The session request carries no operation!");
+    }
+
+    response->set_code(status.error_code());
+    response->set_error_message(status.error_message());
+}
+
+grpc::Status
+SealCore::storage_info(
+    const StorageInfoMessage* message,
+    StorageInfoResponse* response)
+{
+    std::shared_lock<std::shared_mutex> lock(storage_lock);
+
+    std::vector<uint64_t> handles(message->handles().begin(), message->handles().end());
+    size_t memory_bytes = 0;
+    for (size_t i = 0; i < storage.size(); i++) {
+        if (storage[i] == nullptr) {
+            continue;
+        }
+        memory_bytes += storage[i]->store->memory_size();
+        if (message->handles_size() == 0) {
+            handles.push_back(i);
+        }
+    }
+
+    for (const uint64_t& handle : handles) {
+        if (handle >= storage.size() || storage[handle] == nullptr) {
+            return grpc::Status(grpc::OUT_OF_RANGE, "The storage handle " + std::to_string(handle) + " is not valid!");
+        }
+
+        const BucketStoreInterface& store = *storage[handle]->store;
+        StorageInfo* info = response->add_storages();
+        info->set_handle(handle);
+        info->set_number_of_buckets(store.size());
+        info->set_bucket_size(store.bucket_size());
+        info->set_memory_bytes(store.memory_size());
+        info->set_disk_bytes(store.disk_size());
+    }
+    response->set_memory_budget(options.memory_budget);
+    response->set_memory_bytes(memory_bytes);
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::insert_handler(
+    const InsertMessage* message,
+    google::protobuf::Empty* e)
+{
+    const std::string table = message->table();
+    const int value_size = message->values_size();
+
+    std::vector<std::string> values;
+    for (int i = 0; i < value_size; i++) {
+        values.push_back(message->values(i));
+    }
+
+    std::lock_guard<std::mutex> lock(connector_lock);
+    try {
+        connector.get()->insert_handler(table, values);
+    } catch (const pqxx::sql_error& e) {
+        return grpc::Status(grpc::FAILED_PRECONDITION, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+grpc::Status
+SealCore::select_handler(
+    const SelectMessage* message,
+    SelectResult* reponse)
+{
+    const std::string table = message->table();
+    const std::string where = message->document_id();
+    const int column_size = message->columns_size();
+    std::vector<std::string> columns;
+
+    for (int i = 0; i < column_size; i++) {
+        columns.push_back(message->columns(i));
+    }
+
+    std::lock_guard<std::mutex> lock(connector_lock);
+    try {
+        connector.get()->select_handler(table, where, columns);
+    } catch (pqxx::sql_error& e) {
+        return grpc::Status(grpc::FAILED_PRECONDITION, e.what());
+    }
+
+    return grpc::Status::OK;
+}
+
+uint64_t SealCore::reserve_handle(const bool& is_odict, const unsigned int& oram_id, const std::string& map_key)
+{
+    if (is_odict == true) {
+        const auto iter = odict_handles.find(map_key);
+        if (iter != odict_handles.end()) {
+            return iter->second;
+        }
+        odict_handles[map_key] = storage.size();
+    } else {
+        const auto iter = oram_handles.find(map_key);
+        const size_t oram_number = iter == oram_handles.end() ? 0 : iter->second.size();
+
+        if (oram_id < oram_number) {
+            return iter->second[oram_id];
+        } else if (oram_id > oram_number) {
+            throw std::out_of_range("The ORAM ID is not correct because"
+                                    "it exceeds the maximum allowed bound!");
+        }
+        oram_handles[map_key].push_back(storage.size());
+    }
+
+    storage.push_back(nullptr);
+    return storage.size() - 1;
+}
+
+std::string SealCore::tree_label(const bool& is_odict, const unsigned int& oram_id, const std::string& map_key)
+{
+    if (is_odict == true) {
+        return "odict " + map_key;
+    } else {
+        return "oram " + std::to_string(oram_id) + " " + map_key;
+    }
+}
+
+std::string SealCore::tree_path(const uint64_t& handle)
+{
+    return options.directory + "/" + std::to_string(handle) + ".tree";
+}
+
+std::unique_ptr<BucketStoreInterface>
+SealCore::create_store(
+    const uint64_t& handle, const std::string& label,
+    const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size)
+{
+    const size_t available = memory_available(handle);
+
+    if (options.backend == MAPPED_STORAGE) {
+        return std::make_unique<MappedBucketStore>(
+            tree_path(handle), num_buckets, slots_per_bucket, block_size, label, options.sync_policy,
+            options.subtree_levels, options.cached_levels);
+    } else if (options.backend == TIERED_STORAGE) {
+        const size_t num_levels = get_num_levels(num_buckets);
+        // Each tree rounds its arena up to whole huge pages, so the rounded size is what counts against the budget.
+        size_t memory_levels = 0;
+        while (memory_levels < num_levels
+            && MemoryBucketStore::mapping_size(
+                   std::min((1UL << (memory_levels + 1)) - 1, num_buckets), slots_per_bucket, block_size, options.huge_pages)
+                <= available) {
+            memory_levels++;
+        }
+        return std::make_unique<TieredBucketStore>(
+            options.directory, num_buckets, slots_per_bucket, block_size, memory_levels, options.huge_pages);
+    } else {
+        if (MemoryBucketStore::mapping_size(num_buckets, slots_per_bucket, block_size, options.huge_pages) > available) {
+            throw std::length_error("The tree does not fit in the memory budget of the server.");
+        }
+        return std::make_unique<MemoryBucketStore>(num_buckets, slots_per_bucket, block_size, options.huge_pages);
+    }
+}
+
+size_t SealCore::memory_available(const uint64_t& handle)
+{
+    if (options.memory_budget == 0) {
+        return SIZE_MAX;
+    }
+
+    std::shared_lock<std::shared_mutex> lock(storage_lock);
+    size_t memory_used = 0;
+    for (size_t i = 0; i < storage.size(); i++) {
+        if (i != handle && storage[i] != nullptr) {
+            memory_used += storage[i]->store->memory_size();
+        }
+    }
+    return memory_used >= options.memory_budget ? 0 : options.memory_budget - memory_used;
+}
+
+void SealCore::restore_storage()
+{
+    std::filesystem::create_directories(options.directory);
+
+    for (const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(options.directory)) {
+        const std::filesystem::path path = file.path();
+        if (path.extension() == ".tmp") {
+            /* A tree that was still being built when the server stopped. */
+            std::filesystem::remove(path);
+            continue;
+        } else if (path.extension() != ".tree") {
+            continue;
+        }
+
+        try {
+            const uint64_t handle = std::stoull(path.stem().string());
+            std::unique_ptr<MappedBucketStore> tree = std::make_unique<MappedBucketStore>(
+                path.string(), options.sync_policy, options.cached_levels);
+            const std::string label = tree->get_label();
+
+            register_tree(handle, label, std::move(tree));
+            std::cout << "Reopened " << path.string() << std::endl;
+        } catch (const std::exception& e) {
+            PLOG(plog::error) << "Cannot reopen " << path.string() << ": " << e.what();
+        }
+    }
+
+    fill_handles();
+}
+
+void SealCore::register_tree(const uint64_t& handle, const std::string& label, std::unique_ptr<BucketStoreInterface> store)
+{
+    std::istringstream stream(label);
+    std::string kind, map_key;
+    unsigned int oram_id = 0;
+    stream >> kind;
+    if (kind == "oram") {
+        stream >> oram_id;
+    }
+    stream.get();
+    std::getline(stream, map_key, '\0');
+
+    if (handle >= storage.size()) {
+        storage.resize(handle + 1);
+    }
+    storage[handle] = std::make_shared<StorageEntry>();
+    storage[handle]->store = std::move(store);
+
+    if (kind == "odict") {
+        odict_handles[map_key] = handle;
+    } else {
+        std::vector<uint64_t>& handles = oram_handles[map_key];
+        if (oram_id >= handles.size()) {
+            handles.resize(oram_id + 1, NO_HANDLE);
+        }
+        handles[oram_id] = handle;
+    }
+}
+
+void SealCore::fill_handles()
+{
+    /* The sub-ORAMs whose trees are missing get an empty handle that set_capacity can fill. */
+    for (auto iter = oram_handles.begin(); iter != oram_handles.end(); iter++) {
+        for (uint64_t& handle : iter->second) {
+            if (handle == NO_HANDLE) {
+                handle = storage.size();
+                storage.push_back(nullptr);
+            }
+        }
+    }
+}
+
+bool SealCore::buckets_on_disk() const
+{
+    return options.backend != MEMORY_STORAGE;
+}
+
+bool SealCore::checkpoint()
+{
+    std::lock_guard<std::mutex> guard(checkpoint_lock);
+
+    std::vector<std::pair<uint64_t, std::string>> trees;
+    std::vector<std::shared_ptr<StorageEntry>> entries;
+    {
+        std::shared_lock<std::shared_mutex> lock(storage_lock);
+        for (auto iter = odict_handles.begin(); iter != odict_handles.end(); iter++) {
+            trees.emplace_back(iter->second, tree_label(true, 0, iter->first));
+        }
+        for (auto iter = oram_handles.begin(); iter != oram_handles.end(); iter++) {
+            for (unsigned int i = 0; i < iter->second.size(); i++) {
+                trees.emplace_back(iter->second[i], tree_label(false, i, iter->first));
+            }
+        }
+        for (const std::pair<uint64_t, std::string>& tree : trees) {
+            entries.push_back(storage[tree.first]);
+        }
+    }
+
+    bool is_saved = true;
+    for (size_t i = 0; i < trees.size(); i++) {
+        if (entries[i] == nullptr) {
+            continue;
+        }
+
+        /* Writers are held off, so that no bucket is saved half written. */
+        std::shared_lock<std::shared_mutex> lock(entries[i]->lock);
+        try {
+            MemoryBucketStore* const store = dynamic_cast<MemoryBucketStore*>(entries[i]->store.get());
+            if (snapshots != nullptr && store != nullptr) {
+                snapshots->save(trees[i].first, trees[i].second, *store);
+            } else {
+                entries[i]->store->sync();
+            }
+        } catch (const std::exception& e) {
+            PLOG(plog::error) << e.what();
+            is_saved = false;
+        }
+    }
+
+    if (snapshots != nullptr) {
+        try {
+            snapshots->commit();
+        } catch (const std::exception& e) {
+            PLOG(plog::error) << e.what();
+            is_saved = false;
+        }
+    }
+
+    return is_saved;
+}
+
+void SealCore::checkpoint_periodically(const unsigned int& interval)
+{
+    std::unique_lock<std::mutex> lock(stop_lock);
+    while (!stop_condition.wait_for(lock, std::chrono::milliseconds(interval), [this] { return stopping; })) {
+        lock.unlock();
+        checkpoint();
+        lock.lock();
+    }
+}
+
+std::shared_ptr<SealCore::StorageEntry>
+SealCore::get_storage(const uint64_t& handle)
+{
+    std::shared_lock<std::shared_mutex> lock(storage_lock);
+
+    if (handle >= storage.size() || storage[handle] == nullptr) {
+        throw std::out_of_range("The storage handle " + std::to_string(handle) + " is not valid!");
+    }
+    return storage[handle];
+}
+
+void SealCore::print_blocks(const BucketStoreInterface& storage)
+{
+    std::string slot(Block::slot_size(storage.block_size()), '\0');
+    for (size_t i = 0; i < storage.size(); i++) {
+        for (size_t j = 0; j < storage.num_slots(); j++) {
+            storage.read_slot(i, j, slot.data());
+            Block::read_slot(slot.data(), storage.block_size()).printBlock();
+        }
+    }
+}
+
+void SealCore::print_oram_blocks()
+{
+    std::shared_lock<std::shared_mutex> lock(storage_lock);
+
+    std::cout << "----------------- Oblivious Dictionary ----------------------" << std::endl;
+    for (auto iter = odict_handles.begin(); iter != odict_handles.end(); iter++) {
+        if (storage[iter->second] == nullptr) {
+            continue;
+        }
+        std::shared_lock<std::shared_mutex> entry_lock(storage[iter->second]->lock);
+        print_blocks(*storage[iter->second]->store);
+    }
+    std::cout << "--------------------- Oblivious RAM -------------------------" << std::endl;
+    for (auto iter = oram_handles.begin(); iter != oram_handles.end(); iter++) {
+        for (unsigned int i = 0; i < iter->second.size(); i++) {
+            if (storage[iter->second[i]] == nullptr) {
+                continue;
+            }
+            std::shared_lock<std::shared_mutex> entry_lock(storage[iter->second[i]]->lock);
+            print_blocks(*storage[iter->second[i]]->store);
+        }
+    }
+}
@@ -17,21 +17,32 @@
 
 #include <plog/Initializers/RollingFileInitializer.h>
 #include <plog/Log.h>
+#include <server/SealCallbackService.h>
 #include <server/SealServerRunner.h>
+#include <server/SealService.h>
 #include <utils.h>
 
+#include <grpc++/resource_quota.h>
 #include <grpc++/security/server_credentials.h>
 
-void SealServerRunner::sig_handler(int t)
-{
-    std::cout << "Received CTRL+C signal call! Stop the server now..." << std::endl;
-    service.get()->print_oram_blocks();
-}
+#include <chrono>
+#include <thread>
 
-void SealServerRunner::run(const std::string& address)
+void SealServerRunner::run(const std::string& address, const StorageOptions& options, const ServerOptions& server_options)
 {
     plog::init(plog::error, "log/server.txt");
-    service = std::make_unique<SealService>();
+    // Block SIGINT before any thread is started, so that every thread inherits the mask and only sigwait() sees it.
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    core = std::make_shared<SealCore>(options);
+    if (server_options.mode == CALLBACK_SERVICE) {
+        service = std::make_unique<SealCallbackService>(core, server_options.workers);
+    } else {
+        service = std::make_unique<SealService>(core);
+    }
     grpc::ServerBuilder server_builder;
     const std::string servercert = read_keycert("keys/server.crt");
     const std::string serverkey = read_keycert("keys/server.key");
@@ -46,10 +57,32 @@ void SealServerRunner::run(const std::string& address)
 
     server_builder.AddListeningPort(address, credentials);
     server_builder.RegisterService(service.get());
+    if (server_options.pollers != 0) {
+        server_builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MIN_POLLERS, server_options.pollers);
+        server_builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS, server_options.pollers);
+    }
+    if (server_options.max_threads != 0) {
+        grpc::ResourceQuota quota("seal");
+        quota.SetMaxThreads(server_options.max_threads);
+        server_builder.SetResourceQuota(quota);
+    }
     server = server_builder.BuildAndStart();
 
     std::cout << "The server starts.\n";
+    std::thread signal_thread([this, signals]() {
+        int received;
+        sigwait(&signals, &received);
+        std::cout << "Received CTRL+C signal call! Stop the server now..." << std::endl;
+        // Sessions and bulk loads stay open as long as their clients do, so they are cancelled after a grace period.
+        server.get()->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(SHUTDOWN_GRACE_SECONDS));
+    });
     server.get()->Wait();
+    signal_thread.join();
+
+    // No call is in flight any more, so the checkpoint sees the final state of every tree.
+    if (!core.get()->checkpoint()) {
+        std::cout << "The storage could not be saved completely; see the log." << std::endl;
+    }
 }
 
 SealServerRunner::~SealServerRunner()
@@ -0,0 +1,273 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <plog/Log.h>
+#include <server/SnapshotDirectory.h>
+#include <utils.h>
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Flush a file and close it, or close it and throw.
+ */
+static void sync_and_close(const int& fd, const std::string& path)
+{
+    if (fsync(fd) != 0) {
+        const int error = errno;
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "Cannot flush " + path);
+    }
+    close(fd);
+}
+
+SnapshotDirectory::SnapshotDirectory(const std::string& directory)
+    : directory(directory)
+    , generation(0)
+{
+}
+
+std::string SnapshotDirectory::path(const std::string& name) const
+{
+    return directory + "/" + name;
+}
+
+std::map<uint64_t, std::pair<std::string, std::unique_ptr<MemoryBucketStore>>>
+SnapshotDirectory::restore(const bool& huge_pages)
+{
+    std::filesystem::create_directories(directory);
+    std::map<uint64_t, std::pair<std::string, std::unique_ptr<MemoryBucketStore>>> trees;
+
+    std::ifstream manifest(path(SNAPSHOT_MANIFEST));
+    uint64_t handle;
+    std::string name;
+    while (manifest >> handle >> name) {
+        std::unique_ptr<MappedBucketStore> file = std::make_unique<MappedBucketStore>(path(name));
+        replay_journal(name, *file);
+
+        std::unique_ptr<MemoryBucketStore> store = std::make_unique<MemoryBucketStore>(
+            file->size(), file->num_slots(), file->block_size(), huge_pages);
+        std::string bucket(file->bucket_size(), '\0');
+        for (size_t i = 0; i < file->size(); i++) {
+            file->read(i, &bucket[0]);
+            store->write(i, bucket);
+        }
+        store->take_dirty();
+        store->set_saved(true);
+
+        uint64_t snapshot_handle, snapshot_generation;
+        if (sscanf(name.c_str(), "%" SCNu64 ".%" SCNu64, &snapshot_handle, &snapshot_generation) == 2) {
+            generation = std::max(generation, snapshot_generation + 1);
+        }
+
+        trees[handle] = std::make_pair(file->get_label(), std::move(store));
+        snapshots[handle] = Snapshot { name, std::move(file) };
+    }
+
+    /* Whatever the manifest does not list is left over from a checkpoint that did not finish. */
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory)) {
+        const std::string file_name = entry.path().filename().string();
+        bool is_listed = file_name == SNAPSHOT_MANIFEST;
+        for (auto iter = snapshots.begin(); iter != snapshots.end(); iter++) {
+            is_listed |= file_name == iter->second.name || file_name == iter->second.name + ".journal";
+        }
+        if (!is_listed) {
+            std::filesystem::remove(entry.path());
+        }
+    }
+
+    return trees;
+}
+
+void SnapshotDirectory::save(const uint64_t& handle, const std::string& label, MemoryBucketStore& store)
+{
+    std::string bucket(store.bucket_size(), '\0');
+
+    if (store.is_saved() == false) {
+        const std::string name = std::to_string(handle) + "." + std::to_string(generation++) + ".snapshot";
+        std::unique_ptr<MappedBucketStore> file = std::make_unique<MappedBucketStore>(
+            path(name), store.size(), store.num_slots(), store.block_size(), label);
+        for (size_t i = 0; i < store.size(); i++) {
+            store.read(i, &bucket[0]);
+            file->write(i, bucket);
+        }
+        file->sync();
+
+        store.take_dirty();
+        store.set_saved(true);
+
+        auto iter = snapshots.find(handle);
+        if (iter != snapshots.end()) {
+            obsolete.push_back(iter->second.name);
+        }
+        snapshots[handle] = Snapshot { name, std::move(file) };
+        return;
+    }
+
+    const std::vector<size_t> positions = store.take_dirty();
+    if (positions.empty()) {
+        return;
+    }
+
+    try {
+        Snapshot& snapshot = snapshots.at(handle);
+        write_journal(snapshot.name, store, positions);
+        for (const size_t& position : positions) {
+            store.read(position, &bucket[0]);
+            snapshot.file->write(position, bucket);
+        }
+        snapshot.file->sync();
+        // The snapshot holds the buckets now, so a restart must not replay them again.
+        unlink((path(snapshot.name) + ".journal").c_str());
+    } catch (...) {
+        // The dirty buckets are forgotten by now, so the next checkpoint has to write the tree whole.
+        store.set_saved(false);
+        throw;
+    }
+}
+
+void SnapshotDirectory::write_journal(const std::string& name, const MemoryBucketStore& store, const std::vector<size_t>& positions)
+{
+    const size_t record_size = sizeof(uint64_t) + store.bucket_size();
+    std::string journal(sizeof(JournalHeader) + positions.size() * record_size, '\0');
+
+    JournalHeader header;
+    memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    header.count = positions.size();
+    header.bucket_size = store.bucket_size();
+    memcpy(&journal[0], &header, sizeof(header));
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        char* const record = &journal[sizeof(header) + i * record_size];
+        const uint64_t position = positions[i];
+        memcpy(record, &position, sizeof(position));
+        store.read(position, record + sizeof(position));
+    }
+
+    const std::string journal_path = path(name) + ".journal";
+    const int fd = open(journal_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + journal_path);
+    }
+
+    try {
+        // The closing magic only reaches the disk after the records, so a complete journal is a valid one.
+        write_fully(fd, journal.data(), journal.size(), 0);
+        if (fdatasync(fd) != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot flush " + journal_path);
+        }
+        write_fully(fd, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC), journal.size());
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    sync_and_close(fd, journal_path);
+}
+
+void SnapshotDirectory::replay_journal(const std::string& name, MappedBucketStore& file)
+{
+    const std::string journal_path = path(name) + ".journal";
+    const int fd = open(journal_path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+
+    struct stat status;
+    JournalHeader header;
+    char magic[sizeof(JOURNAL_MAGIC)];
+    std::string journal;
+    try {
+        if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(header) + sizeof(magic)) {
+            close(fd);
+            return;
+        }
+        read_fully(fd, (char*)&header, sizeof(header), 0);
+        read_fully(fd, magic, sizeof(magic), status.st_size - sizeof(magic));
+
+        const size_t record_size = sizeof(uint64_t) + file.bucket_size();
+        if (memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 || memcmp(magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0
+            || header.bucket_size != file.bucket_size()
+            || (size_t)status.st_size != sizeof(header) + header.count * record_size + sizeof(magic)) {
+            // The checkpoint stopped while writing the journal, so the snapshot was not touched yet.
+            close(fd);
+            unlink(journal_path.c_str());
+            return;
+        }
+
+        journal.resize(header.count * record_size);
+        read_fully(fd, &journal[0], journal.size(), sizeof(header));
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    close(fd);
+
+    const size_t record_size = sizeof(uint64_t) + file.bucket_size();
+    for (size_t i = 0; i < header.count; i++) {
+        uint64_t position;
+        memcpy(&position, &journal[i * record_size], sizeof(position));
+        file.write(position, std::string_view(&journal[i * record_size + sizeof(position)], file.bucket_size()));
+    }
+    file.sync();
+    unlink(journal_path.c_str());
+}
+
+void SnapshotDirectory::commit()
+{
+    std::string manifest;
+    for (auto iter = snapshots.begin(); iter != snapshots.end(); iter++) {
+        manifest += std::to_string(iter->first) + " " + iter->second.name + "\n";
+    }
+
+    const std::string manifest_path = path(SNAPSHOT_MANIFEST);
+    const std::string temporary_path = manifest_path + ".tmp";
+    const int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + temporary_path);
+    }
+    try {
+        write_fully(fd, manifest.data(), manifest.size(), 0);
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+    sync_and_close(fd, temporary_path);
+
+    if (rename(temporary_path.c_str(), manifest_path.c_str()) != 0) {
+        throw std::system_error(errno, std::generic_category(), "Cannot rename " + temporary_path);
+    }
+    const int directory_fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (directory_fd != -1) {
+        sync_and_close(directory_fd, directory);
+    }
+
+    for (const std::string& name : obsolete) {
+        unlink(path(name).c_str());
+        unlink((path(name) + ".journal").c_str());
+    }
+    obsolete.clear();
+}
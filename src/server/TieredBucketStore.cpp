@@ -0,0 +1,162 @@
+/*
+ Copyright (c) 2021 Haobin Chen
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <oram/Block.h>
+#include <server/TieredBucketStore.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * @brief The size of the buffer with which the file is filled with dummies.
+ */
+#define FILL_CHUNK_SIZE (1 << 20)
+
+TieredBucketStore::TieredBucketStore(
+    const std::string& directory, const size_t& num_buckets, const size_t& slots_per_bucket, const size_t& block_size,
+    const size_t& memory_levels, const bool& huge_pages)
+    : hot(std::min(memory_levels >= 64 ? num_buckets : (1UL << memory_levels) - 1, num_buckets), slots_per_bucket, block_size, huge_pages)
+    , fd(-1)
+    , num_buckets(num_buckets)
+    , slots_per_bucket(slots_per_bucket)
+    , slot_size(Block::slot_size(block_size))
+{
+    if (disk_size() == 0) {
+        return;
+    }
+
+    std::string path = directory + "/tier.XXXXXX";
+    fd = mkstemp(&path[0]);
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "Cannot create a file in " + directory);
+    }
+    // Nothing else ever opens the file, so it is removed as soon as the store closes it.
+    unlink(path.c_str());
+
+    const int error = posix_fallocate(fd, 0, disk_size());
+    if (error != 0 && error != EOPNOTSUPP) {
+        close(fd);
+        throw std::system_error(error, std::generic_category(), "Cannot allocate the levels on disk");
+    }
+
+    const size_t chunk_buckets = std::max<size_t>(1, FILL_CHUNK_SIZE / bucket_size());
+    std::string dummies(chunk_buckets * bucket_size(), '\0');
+    const Block dummy;
+    for (size_t i = 0; i < chunk_buckets * slots_per_bucket; i++) {
+        dummy.write_slot(&dummies[i * slot_size], block_size);
+    }
+
+    try {
+        for (size_t offset = 0; offset < disk_size(); offset += dummies.size()) {
+            write_fully(fd, dummies.data(), std::min(dummies.size(), disk_size() - offset), offset);
+        }
+    } catch (...) {
+        close(fd);
+        throw;
+    }
+}
+
+TieredBucketStore::~TieredBucketStore()
+{
+    if (fd != -1) {
+        close(fd);
+    }
+}
+
+size_t TieredBucketStore::size() const
+{
+    return num_buckets;
+}
+
+size_t TieredBucketStore::num_slots() const
+{
+    return slots_per_bucket;
+}
+
+size_t TieredBucketStore::block_size() const
+{
+    return slot_size - sizeof(SlotHeader);
+}
+
+size_t TieredBucketStore::bucket_size() const
+{
+    return slots_per_bucket * slot_size;
+}
+
+size_t TieredBucketStore::memory_size() const
+{
+    return hot.memory_size();
+}
+
+size_t TieredBucketStore::disk_size() const
+{
+    return (num_buckets - hot.size()) * bucket_size();
+}
+
+void TieredBucketStore::check_position(const size_t& position) const
+{
+    if (position >= num_buckets) {
+        throw std::out_of_range(
+            "Bucket " + std::to_string(position) + " is out of the ORAM tree of " + std::to_string(num_buckets) + " buckets.");
+    }
+}
+
+void TieredBucketStore::read(const size_t& position, char* destination) const
+{
+    check_position(position);
+    if (position < hot.size()) {
+        hot.read(position, destination);
+    } else {
+        read_fully(fd, destination, bucket_size(), (position - hot.size()) * bucket_size());
+    }
+}
+
+void TieredBucketStore::read_slot(const size_t& position, const size_t& offset, char* destination) const
+{
+    check_position(position);
+    if (position < hot.size()) {
+        hot.read_slot(position, offset, destination);
+        return;
+    }
+
+    if (offset >= slots_per_bucket) {
+        throw std::out_of_range("the slot " + std::to_string(offset) + " is not in the bucket.");
+    }
+    read_fully(fd, destination, slot_size, (position - hot.size()) * bucket_size() + offset * slot_size);
+}
+
+void TieredBucketStore::write(const size_t& position, std::string_view bucket)
+{
+    check_position(position);
+    if (position < hot.size()) {
+        hot.write(position, bucket);
+        return;
+    }
+
+    if (bucket.size() != bucket_size()) {
+        throw std::invalid_argument(
+            "The bucket has " + std::to_string(bucket.size()) + " bytes, but a bucket of this ORAM has " + std::to_string(bucket_size()) + " bytes.");
+    }
+    write_fully(fd, bucket.data(), bucket.size(), (position - hot.size()) * bucket_size());
+}
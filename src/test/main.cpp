@@ -26,7 +26,7 @@ int main(int argc, const char** args)
     // Every time the client will sample a new key from the password.
     /*
     try {
-        SEAL::Client* client = new SEAL::Client(256, 256, sizeof(ODict::Node), 1024, INT_MAX, 2, 2, "123456789", PSQL_CONNECTION_INFORMATION);
+        SEAL::Client* client = new SEAL::Client(256, 256, 0, 1024, INT_MAX, 2, 2, "123456789", PSQL_CONNECTION_INFORMATION);
         client->test_adj("./input/test.txt");
 
         std::cout << "sql: " << std::endl;
@@ -41,7 +41,7 @@ int main(int argc, const char** args)
     */
 
     try {
-        ClientRunner client(256, 256, sizeof(ODict::Node), 1024, INT_MAX, 2, 2, "123456789", PSQL_CONNECTION_INFORMATION, sizeof(unsigned int), 6, "test", "localhost:4567");
+        ClientRunner client(256, 256, 0, 1024, INT_MAX, 2, 2, "123456789", PSQL_CONNECTION_INFORMATION, sizeof(unsigned int), 6, "test", "localhost:4567");
         client.test_adj("input/test.csv");
         // Currently the keyword is defined as <file_path>_<column_name>_<value>...
         std::vector<SEAL::Document> ans = client.search_range("input/test.csvkwd1", "3", "5");
@@ -0,0 +1,112 @@
+#include <oram/Block.h>
+#include <server/MappedBucketStore.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#define TEST_SLOTS 4
+#define TEST_BLOCK_SIZE 20
+
+/* A bucket that tells its position apart from every other one. */
+static std::string make_bucket(const size_t& position, const size_t& bucket_size)
+{
+    std::string bucket(bucket_size, '\0');
+    for (size_t i = 0; i < bucket_size; i++) {
+        bucket[i] = (char)(position * 31 + i);
+    }
+    memcpy(&bucket[0], &position, sizeof(position));
+    return bucket;
+}
+
+static bool check_read_back(const MappedBucketStore& store)
+{
+    bool ok = true;
+    std::string bucket(store.bucket_size(), '\0');
+    for (size_t i = 0; i < store.size(); i++) {
+        store.read(i, &bucket[0]);
+        ok &= bucket == make_bucket(i, store.bucket_size());
+    }
+    return ok;
+}
+
+/**
+ * Finds every bucket in the file: no two positions may share an extent offset or overlap, and every subtree
+ * of a band has to start on an aligned extent.
+ */
+static bool check_offsets(const std::string& path, const size_t& num_buckets, const size_t& bucket_size, const size_t& subtree_levels)
+{
+    std::ifstream file(path, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    bool ok = true;
+    std::vector<size_t> offsets(num_buckets);
+    for (size_t i = 0; i < num_buckets; i++) {
+        const size_t offset = contents.find(make_bucket(i, bucket_size), TREE_HEADER_SIZE);
+        if (offset == std::string::npos) {
+            return false;
+        }
+        offsets[i] = offset - TREE_HEADER_SIZE;
+
+        const size_t level = get_num_levels(i + 1) - 1;
+        if (subtree_levels != 0 && level % subtree_levels == 0) {
+            ok &= offsets[i] % TREE_EXTENT_ALIGNMENT == 0;
+        }
+    }
+
+    std::sort(offsets.begin(), offsets.end());
+    for (size_t i = 1; i < num_buckets; i++) {
+        ok &= offsets[i] >= offsets[i - 1] + bucket_size;
+    }
+    return ok;
+}
+
+static bool test_layout(const size_t& num_levels, const size_t& subtree_levels)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "test_mapped_store.tree").string();
+    const size_t num_buckets = (1UL << num_levels) - 1;
+
+    bool ok = true;
+    size_t bucket_size;
+    {
+        MappedBucketStore store(path, num_buckets, TEST_SLOTS, TEST_BLOCK_SIZE, "test", SYNC_NONE, subtree_levels);
+        bucket_size = store.bucket_size();
+        for (size_t i = 0; i < num_buckets; i++) {
+            store.write(i, make_bucket(i, bucket_size));
+        }
+        ok &= check_read_back(store);
+        store.sync();
+    }
+
+    // The layout is read back from the header.
+    {
+        MappedBucketStore store(path);
+        ok &= check_read_back(store);
+    }
+    ok &= check_offsets(path, num_buckets, bucket_size, subtree_levels);
+    std::filesystem::remove(path);
+
+    printf("%zu levels, subtrees of %zu levels: %s\n", num_levels, subtree_levels, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+int main(int argc, const char** argv)
+{
+    bool ok = true;
+    // Neither height is a multiple of 2 or 3, so the last band is cut short.
+    const size_t heights[] = { 5, 7 };
+    const size_t subtrees[] = { 0, 1, 2, 3 };
+    for (const size_t& num_levels : heights) {
+        for (const size_t& subtree_levels : subtrees) {
+            ok &= test_layout(num_levels, subtree_levels);
+        }
+    }
+
+    return ok ? 0 : 1;
+}
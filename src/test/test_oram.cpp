@@ -0,0 +1,524 @@
+#include <oram/BoundedRandomForOram.h>
+#include <oram/CircuitOram.h>
+#include <oram/EncryptedStorage.h>
+#include <oram/OramPositionMap.h>
+#include <oram/OramReadPathEviction.h>
+#include <oram/RingOram.h>
+#include <oram/Stash.h>
+#include <oram/TreeTopCacheStorage.h>
+#include <oram/UntrustedStorageInterface.h>
+#include <proto/seal.pb.h>
+#include <utils.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define NUM_BLOCKS 256
+#define NUM_ACCESSES 4000
+#define NUM_BATCHES 500
+#define BATCH_SIZE 8
+#define TEST_BLOCK_SIZE 32
+#define TEST_BUCKET_KEY "0123456789abcdef"
+
+/* Path ORAM with Z = 4 overflows a stash of this size with negligible probability. */
+#define PATH_STASH_BOUND 40
+
+/* Ring ORAM with Z = 4, S = 6 and A = 3, which keeps the stash of the same order as Path ORAM. */
+#define RING_STASH_BOUND 50
+
+/* Circuit ORAM with Z = 2 evicts twice per access, which keeps the stash much smaller. */
+#define CIRCUIT_STASH_BOUND 20
+
+/* The recursive position map packs this many leaves per block and stops at this many blocks. */
+#define POSITION_MAP_ENTRIES 4
+#define POSITION_MAP_THRESHOLD 4
+
+/**
+ * Keeps the buckets in memory in place of the server, in the same heap order.
+ */
+class MemoryStorage : public UntrustedStorageInterface {
+public:
+    std::vector<Bucket> buckets;
+
+    int num_levels = 0;
+
+    int block_size = 0;
+
+    void setCapacity(const int& total_num_of_buckets, const int& slots_per_bucket, const int& block_size)
+    {
+        buckets.assign(total_num_of_buckets, Bucket(slots_per_bucket, block_size));
+        num_levels = get_num_levels(total_num_of_buckets);
+        this->block_size = block_size;
+    }
+
+    Bucket ReadBucket(const int& position) { return buckets.at(position); }
+
+    void WriteBucket(const int& position, const Bucket& bucket_to_write) { buckets.at(position) = bucket_to_write; }
+
+    std::vector<Bucket> ReadPath(const int& leaf, const int& start_level)
+    {
+        std::vector<Bucket> path;
+        for (int l = start_level; l < num_levels; l++) {
+            path.push_back(buckets.at(get_bucket_position(leaf, l, num_levels)));
+        }
+        return path;
+    }
+
+    void WritePath(const int& leaf, const std::vector<Bucket>& buckets_to_write, const int& start_level)
+    {
+        for (int l = start_level; l < num_levels; l++) {
+            buckets.at(get_bucket_position(leaf, l, num_levels)) = buckets_to_write.at(l - start_level);
+        }
+    }
+
+    std::vector<Block> ReadBlocks(const int& leaf, const std::vector<int>& offsets, const int& start_level)
+    {
+        std::vector<Block> blocks;
+        for (int l = start_level; l < num_levels; l++) {
+            blocks.push_back(buckets.at(get_bucket_position(leaf, l, num_levels)).getBlockAt(offsets.at(l - start_level)));
+        }
+        return blocks;
+    }
+
+    bool is_vectored() { return true; }
+
+    void add_read(VectoredMessage& message, const std::vector<int>& positions)
+    {
+        BucketsReadMessage* read = message.add_reads();
+        for (const int& position : positions) {
+            read->add_positions(position);
+        }
+    }
+
+    std::vector<Bucket> take_read(BucketsReadResponse& response, const std::vector<int>& positions)
+    {
+        if (response.buckets_size() != (int)positions.size()) {
+            throw std::runtime_error("The response does not have a bucket for every position.");
+        }
+        std::vector<Bucket> read;
+        for (int i = 0; i < response.buckets_size(); i++) {
+            read.emplace_back(std::move(*response.mutable_buckets(i)), block_size);
+        }
+        return read;
+    }
+
+    void add_write(VectoredMessage& message, const std::vector<int>& positions, const std::vector<Bucket>& buckets_to_write)
+    {
+        BucketsWriteMessage* write = message.add_writes();
+        for (size_t i = 0; i < positions.size(); i++) {
+            write->add_positions(positions[i]);
+            write->add_buckets(buckets_to_write.at(i).getBuffer());
+        }
+    }
+
+    /* Serve a vectored request, the writes before the reads, as the server does. */
+    VectoredResponse serve(const VectoredMessage& message)
+    {
+        for (const BucketsWriteMessage& write : message.writes()) {
+            for (int i = 0; i < write.positions_size(); i++) {
+                buckets.at(write.positions(i)) = Bucket(std::string(write.buckets(i)), block_size);
+            }
+        }
+        VectoredResponse response;
+        for (const BucketsReadMessage& read : message.reads()) {
+            BucketsReadResponse* buckets_read = response.add_reads();
+            for (const int& position : read.positions()) {
+                buckets_read->add_buckets(buckets.at(position).getBuffer());
+            }
+        }
+        return response;
+    }
+};
+
+/* Runs one batch of operations on an ORAM and returns what each of them read. */
+typedef std::function<std::vector<std::string>(OramInterface*, const std::vector<OramInterface::BatchOperation>&)> BatchRunner;
+
+static std::vector<std::pair<unsigned int, std::string>> make_dataset()
+{
+    std::vector<std::pair<unsigned int, std::string>> blocks;
+    for (unsigned int i = 0; i < NUM_BLOCKS; i++) {
+        blocks.emplace_back(i, "block" + std::to_string(i));
+    }
+    return blocks;
+}
+
+/**
+ * Writes (or bulk-loads) every block, then does random reads and writes against a reference map,
+ * and finally reads every block back. Fails if any read differs or the stash ever exceeds stash_bound.
+ */
+static bool check_round_trip(const std::string& name, OramInterface* oram, const bool& preloaded, const int& stash_bound)
+{
+    std::map<unsigned int, std::string> expected;
+    for (auto& item : make_dataset()) {
+        expected[item.first] = item.second;
+        if (!preloaded) {
+            oram->access(OramInterface::WRITE, item.first, item.second);
+        }
+    }
+
+    std::mt19937 rng(NUM_ACCESSES);
+    int max_stash = 0;
+    bool ok = true;
+    for (int i = 0; i < NUM_ACCESSES; i++) {
+        const unsigned int index = rng() % NUM_BLOCKS;
+        if (rng() % 2 == 0) {
+            expected[index] = "update" + std::to_string(i);
+            oram->access(OramInterface::WRITE, index, expected[index]);
+        } else if (oram->access(OramInterface::READ, index, "") != expected[index]) {
+            fprintf(stderr, "%s: block %u has the wrong data after %d accesses\n", name.c_str(), index, i);
+            ok = false;
+        }
+        max_stash = std::max(max_stash, oram->getStashSize());
+    }
+    for (auto iter = expected.begin(); iter != expected.end(); iter++) {
+        if (oram->access(OramInterface::READ, iter->first, "") != iter->second) {
+            fprintf(stderr, "%s: block %u has the wrong data at the end\n", name.c_str(), iter->first);
+            ok = false;
+        }
+    }
+    if (max_stash > stash_bound) {
+        fprintf(stderr, "%s: the stash reached %d blocks, over the bound of %d\n", name.c_str(), max_stash, stash_bound);
+        ok = false;
+    }
+
+    printf("%s: %s (largest stash %d)\n", name.c_str(), ok ? "OK" : "FAILED", max_stash);
+    return ok;
+}
+
+static bool test_path_oram()
+{
+    BoundedRandomForOram random;
+    std::unique_ptr<MemoryStorage> storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> oram(new OramReadPathEviction(storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    bool ok = check_round_trip("path", oram.get(), false, PATH_STASH_BOUND);
+
+    std::unique_ptr<MemoryStorage> loaded_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> loaded(
+        new OramReadPathEviction(loaded_storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_round_trip("path (bulk-loaded)", loaded.get(), true, PATH_STASH_BOUND);
+    return ok;
+}
+
+static bool test_ring_oram()
+{
+    BoundedRandomForOram random;
+    std::unique_ptr<MemoryStorage> storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> oram(new RingOram(storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    bool ok = check_round_trip("ring", oram.get(), false, RING_STASH_BOUND);
+
+    std::unique_ptr<MemoryStorage> loaded_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> loaded(
+        new RingOram(loaded_storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_round_trip("ring (bulk-loaded)", loaded.get(), true, RING_STASH_BOUND);
+    return ok;
+}
+
+static bool test_circuit_oram()
+{
+    BoundedRandomForOram random;
+    std::unique_ptr<MemoryStorage> storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> oram(new CircuitOram(storage.get(), &random, 2, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    bool ok = check_round_trip("circuit", oram.get(), false, CIRCUIT_STASH_BOUND);
+
+    std::unique_ptr<MemoryStorage> loaded_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> loaded(
+        new CircuitOram(loaded_storage.get(), &random, 2, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_round_trip("circuit (bulk-loaded)", loaded.get(), true, CIRCUIT_STASH_BOUND);
+    return ok;
+}
+
+static bool test_tree_top_cache()
+{
+    BoundedRandomForOram random;
+    MemoryStorage* memory = new MemoryStorage();
+    std::unique_ptr<UntrustedStorageInterface> storage(new TreeTopCacheStorage(memory, 3));
+    std::unique_ptr<OramInterface> oram(new OramReadPathEviction(storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    bool ok = check_round_trip("path (cached)", oram.get(), false, PATH_STASH_BOUND);
+
+    // The 7 buckets of the top 3 levels never reach the storage below.
+    bool stays_cached = true;
+    for (int i = 0; i < 7; i++) {
+        const std::string& buffer = memory->buckets[i].getBuffer();
+        stays_cached &= buffer.find("block") == std::string::npos && buffer.find("update") == std::string::npos;
+    }
+    printf("cached levels stay on the client: %s\n", stays_cached ? "OK" : "FAILED");
+
+    std::unique_ptr<UntrustedStorageInterface> loaded_storage(new TreeTopCacheStorage(new MemoryStorage(), 3));
+    std::unique_ptr<OramInterface> loaded(
+        new CircuitOram(loaded_storage.get(), &random, 2, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_round_trip("circuit (cached, bulk-loaded)", loaded.get(), true, CIRCUIT_STASH_BOUND);
+
+    // More levels than the tree has: the whole tree is on the client.
+    std::unique_ptr<UntrustedStorageInterface> whole_storage(new TreeTopCacheStorage(new MemoryStorage(), 64));
+    std::unique_ptr<OramInterface> whole(new OramReadPathEviction(whole_storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    ok &= check_round_trip("path (whole tree cached)", whole.get(), false, PATH_STASH_BOUND);
+    return ok && stays_cached;
+}
+
+/* Builds a recursive position map whose inner ORAMs are kept in memory, and records their names. */
+static OramPositionMap* make_position_map(RandForOramInterface* random, std::vector<std::string>& names)
+{
+    return new OramPositionMap(
+        NUM_BLOCKS, random, 4, POSITION_MAP_THRESHOLD, "recursive",
+        [&names](const std::string& name) {
+            names.push_back(name);
+            return new MemoryStorage();
+        },
+        POSITION_MAP_ENTRIES);
+}
+
+static bool test_position_map()
+{
+    // 256 blocks map to inner ORAMs of 64, 16 and 4 blocks; the last of them keeps its map on the client.
+    const std::vector<std::string> levels = { "recursive#pos0", "recursive#pos1", "recursive#pos2" };
+
+    BoundedRandomForOram random;
+    std::unique_ptr<MemoryStorage> storage(new MemoryStorage());
+    std::vector<std::string> names;
+    std::unique_ptr<OramInterface> oram(new OramReadPathEviction(
+        storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE, make_position_map(&random, names)));
+    bool ok = check_round_trip("path (recursive position map)", oram.get(), false, PATH_STASH_BOUND);
+
+    BoundedRandomForOram loaded_random;
+    std::unique_ptr<MemoryStorage> loaded_storage(new MemoryStorage());
+    std::vector<std::string> loaded_names;
+    std::unique_ptr<OramInterface> loaded(new OramReadPathEviction(
+        loaded_storage.get(), &loaded_random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE,
+        make_position_map(&loaded_random, loaded_names)));
+    ok &= check_round_trip("path (recursive position map, bulk-loaded)", loaded.get(), true, PATH_STASH_BOUND);
+
+    const bool recursed = names == levels && loaded_names == levels;
+    printf("position map recurses down to the threshold: %s\n", recursed ? "OK" : "FAILED");
+    return ok && recursed;
+}
+
+/**
+ * Runs random batches, which may access a block more than once, against a reference map on a bulk-loaded ORAM.
+ * The operations of a batch take effect in order, so a read after a write of the same block sees the new data.
+ */
+static bool check_batches(const std::string& name, OramInterface* oram, const BatchRunner& run, const int& stash_bound)
+{
+    const std::vector<std::pair<unsigned int, std::string>> dataset = make_dataset();
+    std::map<unsigned int, std::string> expected(dataset.begin(), dataset.end());
+
+    std::mt19937 rng(NUM_BATCHES);
+    int max_stash = 0;
+    bool ok = true;
+    for (int i = 0; i < NUM_BATCHES && ok; i++) {
+        std::vector<OramInterface::BatchOperation> ops(BATCH_SIZE);
+        std::vector<std::string> want(BATCH_SIZE);
+        for (int j = 0; j < BATCH_SIZE; j++) {
+            // A small range of blocks every other batch, so that many batches repeat a block.
+            ops[j].block_index = rng() % (i % 2 == 0 ? NUM_BLOCKS : 4);
+            if (rng() % 2 == 0) {
+                ops[j].op = OramInterface::WRITE;
+                ops[j].data = "batch" + std::to_string(i) + "-" + std::to_string(j);
+                expected[ops[j].block_index] = ops[j].data;
+            } else {
+                ops[j].op = OramInterface::READ;
+                want[j] = expected[ops[j].block_index];
+            }
+        }
+
+        if (run(oram, ops) != want) {
+            fprintf(stderr, "%s: batch %d read the wrong data\n", name.c_str(), i);
+            ok = false;
+        }
+        max_stash = std::max(max_stash, oram->getStashSize());
+    }
+    for (auto iter = expected.begin(); iter != expected.end() && ok; iter++) {
+        if (oram->access(OramInterface::READ, iter->first, "") != iter->second) {
+            fprintf(stderr, "%s: block %u has the wrong data at the end\n", name.c_str(), iter->first);
+            ok = false;
+        }
+    }
+    if (max_stash > stash_bound) {
+        fprintf(stderr, "%s: the stash reached %d blocks, over the bound of %d\n", name.c_str(), max_stash, stash_bound);
+        ok = false;
+    }
+
+    printf("%s: %s (largest stash %d)\n", name.c_str(), ok ? "OK" : "FAILED", max_stash);
+    return ok;
+}
+
+static std::vector<std::string> run_access_batch(OramInterface* oram, const std::vector<OramInterface::BatchOperation>& ops)
+{
+    return oram->access_batch(ops);
+}
+
+/* Runs a batch in two phases around a read and a write of the storage, as OramAccessScheduler does. */
+static BatchRunner run_two_phases(UntrustedStorageInterface* storage)
+{
+    return [storage](OramInterface* oram, const std::vector<OramInterface::BatchOperation>& ops) {
+        const std::vector<int> positions = oram->begin_batch(ops);
+        std::vector<Bucket> buckets = storage->ReadBuckets(positions);
+
+        std::vector<Bucket> evicted;
+        std::vector<std::string> results = oram->finish_batch(ops, buckets, evicted);
+        storage->WriteBuckets(positions, evicted);
+        return results;
+    };
+}
+
+static bool test_batches()
+{
+    BoundedRandomForOram random;
+    std::unique_ptr<MemoryStorage> storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> oram(
+        new OramReadPathEviction(storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    bool ok = check_batches("path (batched)", oram.get(), run_access_batch, PATH_STASH_BOUND);
+
+    std::unique_ptr<MemoryStorage> phased_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> phased(
+        new OramReadPathEviction(phased_storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_batches("path (batched in two phases)", phased.get(), run_two_phases(phased_storage.get()), PATH_STASH_BOUND);
+
+    // Ring and Circuit ORAM run a batch one access after another.
+    std::unique_ptr<MemoryStorage> ring_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> ring(
+        new RingOram(ring_storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_batches("ring (batched)", ring.get(), run_access_batch, RING_STASH_BOUND);
+
+    std::unique_ptr<MemoryStorage> circuit_storage(new MemoryStorage());
+    std::unique_ptr<OramInterface> circuit(
+        new CircuitOram(circuit_storage.get(), &random, 2, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_batches("circuit (batched)", circuit.get(), run_access_batch, CIRCUIT_STASH_BOUND);
+    return ok;
+}
+
+/* Runs a batch in two phases around a vectored read and a vectored write, as OramAccessScheduler does. */
+static BatchRunner run_vectored(UntrustedStorageInterface* storage, MemoryStorage* memory)
+{
+    return [storage, memory](OramInterface* oram, const std::vector<OramInterface::BatchOperation>& ops) {
+        const std::vector<int> positions = oram->begin_batch(ops);
+        VectoredMessage reads;
+        storage->add_read(reads, positions);
+        VectoredResponse response = memory->serve(reads);
+        std::vector<Bucket> buckets = storage->take_read(*response.mutable_reads(0), positions);
+
+        std::vector<Bucket> evicted;
+        std::vector<std::string> results = oram->finish_batch(ops, buckets, evicted);
+        VectoredMessage writes;
+        storage->add_write(writes, positions, evicted);
+        memory->serve(writes);
+        return results;
+    };
+}
+
+static bool test_vectored_storage()
+{
+    BoundedRandomForOram random;
+    // Sealed buckets under a tree-top cache, which both forward the vectored hooks to the memory below.
+    MemoryStorage* memory = new MemoryStorage();
+    std::unique_ptr<UntrustedStorageInterface> storage(
+        new TreeTopCacheStorage(new EncryptedStorage(memory, TEST_BUCKET_KEY, "vectored"), 2));
+    std::unique_ptr<OramInterface> oram(
+        new OramReadPathEviction(storage.get(), &random, 4, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+
+    bool ok = storage->is_vectored();
+    ok &= check_batches("path (sealed, cached, vectored)", oram.get(), run_vectored(storage.get(), memory), PATH_STASH_BOUND);
+
+    bool is_sealed = true;
+    for (auto iter = memory->buckets.begin(); iter != memory->buckets.end(); iter++) {
+        is_sealed &= iter->getBuffer().find("batch") == std::string::npos;
+    }
+    printf("vectored writes are sealed: %s\n", is_sealed ? "OK" : "FAILED");
+
+    return ok && is_sealed;
+}
+
+/* Expect evicting onto the path to leaf to be rejected, leaving the stash as it was. */
+static bool check_evict_rejected(Stash& stash, const int& leaf, const unsigned int& num_levels)
+{
+    const size_t size = stash.size();
+    try {
+        stash.evict(leaf, num_levels, 4, TEST_BLOCK_SIZE);
+    } catch (const std::out_of_range& e) {
+        return stash.size() == size;
+    }
+    return false;
+}
+
+static bool test_stash_bounds()
+{
+    // A tree of 4 levels has the leaves 0 to 7.
+    Stash stash;
+    stash.add(Block(7, 1, "in the tree"));
+    bool ok = check_evict_rejected(stash, 8, 4) && check_evict_rejected(stash, -1, 4);
+
+    stash.add(Block(8, 2, "past the last leaf"));
+    ok &= check_evict_rejected(stash, 7, 4);
+    stash.remove(2);
+    ok &= stash.evict(7, 4, 4, TEST_BLOCK_SIZE).back().getBlockAt(0).index == 1 && stash.size() == 0;
+
+    printf("leaves outside the tree are rejected by the stash: %s\n", ok ? "OK" : "FAILED");
+    return ok;
+}
+
+/* Expect reading the bucket at position to be rejected by EncryptedStorage. */
+static bool check_rejected(EncryptedStorage* storage, const int& position)
+{
+    try {
+        storage->ReadBucket(position);
+    } catch (const std::runtime_error& e) {
+        return true;
+    }
+    return false;
+}
+
+static bool test_encrypted_storage()
+{
+    BoundedRandomForOram random;
+    // EncryptedStorage owns the storage below it.
+    MemoryStorage* memory = new MemoryStorage();
+    std::unique_ptr<EncryptedStorage> storage(new EncryptedStorage(memory, TEST_BUCKET_KEY, "test"));
+    std::unique_ptr<OramInterface> oram(new OramReadPathEviction(storage.get(), &random, 4, NUM_BLOCKS, TEST_BLOCK_SIZE));
+    bool ok = check_round_trip("path (sealed)", oram.get(), false, PATH_STASH_BOUND);
+
+    MemoryStorage* circuit_memory = new MemoryStorage();
+    std::unique_ptr<EncryptedStorage> circuit_storage(new EncryptedStorage(circuit_memory, TEST_BUCKET_KEY, "circuit"));
+    std::unique_ptr<OramInterface> circuit(
+        new CircuitOram(circuit_storage.get(), &random, 2, NUM_BLOCKS, make_dataset(), TEST_BLOCK_SIZE));
+    ok &= check_round_trip("circuit (sealed, bulk-loaded)", circuit.get(), true, CIRCUIT_STASH_BOUND);
+
+    // No block may reach the storage in the clear.
+    bool is_sealed = true;
+    for (auto iter = circuit_memory->buckets.begin(); iter != circuit_memory->buckets.end(); iter++) {
+        is_sealed &= iter->getBuffer().find("block") == std::string::npos;
+    }
+    printf("sealed buckets hide the blocks: %s\n", is_sealed ? "OK" : "FAILED");
+
+    // A bucket moved to another position fails, and so does a single flipped bit.
+    memory->buckets[1] = memory->buckets[2];
+    bool is_rejected = check_rejected(storage.get(), 1);
+    std::string buffer = memory->buckets[3].getBuffer();
+    buffer[buffer.size() / 2] ^= 1;
+    memory->buckets[3] = Bucket(std::move(buffer), memory->block_size);
+    is_rejected &= check_rejected(storage.get(), 3);
+    is_rejected &= !check_rejected(storage.get(), 4);
+    printf("swapped and tampered buckets are rejected: %s\n", is_rejected ? "OK" : "FAILED");
+
+    return ok && is_sealed && is_rejected;
+}
+
+int main(int argc, const char** argv)
+{
+    bool ok = true;
+    ok &= test_path_oram();
+    ok &= test_ring_oram();
+    ok &= test_circuit_oram();
+    ok &= test_batches();
+    ok &= test_stash_bounds();
+    ok &= test_tree_top_cache();
+    ok &= test_position_map();
+    ok &= test_encrypted_storage();
+    ok &= test_vectored_storage();
+    return ok ? 0 : 1;
+}
@@ -1,19 +1,55 @@
 #include <server/SealServerRunner.h>
 
-#include <signal.h>
 #include <cstdio>
-
-SealServerRunner runner;
-
-void sig_handler(int t)
-{
-    runner.sig_handler(t);
-    exit(1);
-}
+#include <string>
 
 int main(int argc, const char** argv)
 {
-    signal(SIGINT, sig_handler);
-    runner.run("localhost:4567");
+    /*
+     * --huge-pages | --storage-dir <directory> [--sync none|periodic|write] [--subtree-levels k] [--cached-levels l]
+     * | --tiered <directory> | [--checkpoint-dir <directory> [--checkpoint-interval <ms>]],
+     * and --memory-budget <MiB> for any of them;
+     * --callback [--workers n] | [--pollers n] [--max-threads n] for the service.
+     */
+    StorageOptions options;
+    ServerOptions server_options;
+    for (int i = 1; i < argc; i++) {
+        const std::string argument = argv[i];
+        if (argument == "--huge-pages") {
+            options.huge_pages = true;
+        } else if (argument == "--storage-dir" && i + 1 < argc) {
+            options.backend = MAPPED_STORAGE;
+            options.directory = argv[++i];
+        } else if (argument == "--tiered" && i + 1 < argc) {
+            options.backend = TIERED_STORAGE;
+            options.directory = argv[++i];
+        } else if (argument == "--checkpoint-dir" && i + 1 < argc) {
+            options.checkpoint_directory = argv[++i];
+        } else if (argument == "--checkpoint-interval" && i + 1 < argc) {
+            options.checkpoint_interval = std::stoul(argv[++i]);
+        } else if (argument == "--memory-budget" && i + 1 < argc) {
+            options.memory_budget = std::stoul(argv[++i]) << 20;
+        } else if (argument == "--sync" && i + 1 < argc) {
+            const std::string policy = argv[++i];
+            options.sync_policy = policy == "write" ? SYNC_WRITE : policy == "periodic" ? SYNC_PERIODIC : SYNC_NONE;
+        } else if (argument == "--subtree-levels" && i + 1 < argc) {
+            options.subtree_levels = std::stoi(argv[++i]);
+        } else if (argument == "--cached-levels" && i + 1 < argc) {
+            options.cached_levels = std::stoi(argv[++i]);
+        } else if (argument == "--callback") {
+            server_options.mode = CALLBACK_SERVICE;
+        } else if (argument == "--workers" && i + 1 < argc) {
+            server_options.workers = std::stoul(argv[++i]);
+        } else if (argument == "--pollers" && i + 1 < argc) {
+            server_options.pollers = std::stoul(argv[++i]);
+        } else if (argument == "--max-threads" && i + 1 < argc) {
+            server_options.max_threads = std::stoul(argv[++i]);
+        } else {
+            fprintf(stderr, "Unknown argument %s\n", argument.c_str());
+            return 1;
+        }
+    }
+    SealServerRunner runner;
+    runner.run("localhost:4567", options, server_options);
     return 0;
 }
\ No newline at end of file
@@ -1,13 +1,111 @@
 #include <crypto/sm4.h>
 
-#include <iostream>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+/* The example of GB/T 32907-2016: the key and the plaintext are the same block. */
+#define SM4_TEST_KEY "0123456789abcdeffedcba9876543210"
+#define SM4_TEST_CIPHERTEXT "681edf34d206965e86b3e94f536e4246"
+/* The same plaintext encrypted 1,000,000 times with the same key. */
+#define SM4_TEST_CIPHERTEXT_1M "595298c7c6fd271f0402f804c33d3f66"
+
+static std::string from_hex(const std::string& hex)
+{
+    std::string bytes;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        bytes.push_back((char)std::stoi(hex.substr(i, 2), nullptr, 16));
+    }
+    return bytes;
+}
+
+static bool report(const std::string& name, const bool& ok)
+{
+    printf("%s: %s\n", name.c_str(), ok ? "OK" : "FAILED");
+    return ok;
+}
+
+static bool test_vectors()
+{
+    const std::string key = from_hex(SM4_TEST_KEY);
+    SM4Cipher cipher(key);
+
+    std::string block = key;
+    cipher.encrypt_blocks((const unsigned char*)block.data(), (unsigned char*)&block[0], 1);
+    bool ok = report("standard vector", block == from_hex(SM4_TEST_CIPHERTEXT));
+    cipher.decrypt_blocks((const unsigned char*)block.data(), (unsigned char*)&block[0], 1);
+    ok &= report("standard vector decryption", block == key);
+
+    for (unsigned int i = 0; i < 1000000; i++) {
+        cipher.encrypt_blocks((const unsigned char*)block.data(), (unsigned char*)&block[0], 1);
+    }
+    ok &= report("1,000,000 iterations", block == from_hex(SM4_TEST_CIPHERTEXT_1M));
+
+    return ok;
+}
+
+/**
+ * Runs of blocks around multiples of SM4_AVX2_LANES must agree with encrypting every block on its own,
+ * so that the tail left to the scalar kernel is handled like the full lanes.
+ */
+static bool test_bulk()
+{
+    std::mt19937 generator(1);
+    SM4Cipher cipher(from_hex(SM4_TEST_KEY));
+
+    bool ok = true;
+    const size_t counts[] = { 1, SM4_AVX2_LANES - 1, SM4_AVX2_LANES, SM4_AVX2_LANES + 1,
+        2 * SM4_AVX2_LANES + 3, 16 * SM4_AVX2_LANES - 1, 1037 };
+    for (const size_t& count : counts) {
+        std::vector<unsigned char> input(count * 16), bulk(input.size()), single(input.size());
+        for (unsigned char& byte : input) {
+            byte = (unsigned char)generator();
+        }
+
+        cipher.encrypt_blocks(input.data(), bulk.data(), count);
+        for (size_t i = 0; i < count; i++) {
+            cipher.encrypt_blocks(&input[i * 16], &single[i * 16], 1);
+        }
+        ok &= bulk == single;
+
+        // In place, as the batch API does.
+        cipher.decrypt_blocks(bulk.data(), bulk.data(), count);
+        ok &= bulk == input;
+    }
+
+    return report("bulk blocks", ok);
+}
+
+static bool test_batch()
+{
+    std::mt19937 generator(2);
+    SM4Cipher cipher("123");
+
+    // A batch whose total length is not a multiple of SM4_AVX2_LANES blocks, with empty and block-aligned texts.
+    std::vector<std::string> plaintexts;
+    for (unsigned int i = 0; i < 301; i++) {
+        plaintexts.push_back(std::string(i % 7 == 0 ? 16 * (i % 5) : generator() % 70, (char)('a' + i % 26)));
+    }
+
+    const std::vector<std::string> ciphertexts = cipher.encrypt(plaintexts);
+    bool ok = ciphertexts.size() == plaintexts.size();
+    for (size_t i = 0; ok && i < plaintexts.size(); i++) {
+        ok &= ciphertexts[i] == cipher.encrypt(plaintexts[i]);
+        ok &= cipher.decrypt(ciphertexts[i]) == plaintexts[i];
+    }
+    ok &= cipher.decrypt(ciphertexts) == plaintexts;
+    ok &= decrypt_SM4_EBC(encrypt_SM4_EBC(plaintexts[1], "123"), "123") == plaintexts[1];
+
+    return report("batch", ok);
+}
 
 int main(int argc, const char** argv)
 {
-    std::string plain;
-    std::cin >> plain;
-    std::string ciphertext = encrypt_SM4_EBC(plain, "123");
-    std::string plaintext = decrypt_SM4_EBC(ciphertext, "123");
+    bool ok = true;
+    ok &= test_vectors();
+    ok &= test_bulk();
+    ok &= test_batch();
 
-    std::cout << ciphertext << ", " << plaintext << std::endl;
-}
\ No newline at end of file
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include <server/SnapshotDirectory.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#define TEST_BUCKETS 15
+#define TEST_SLOTS 4
+#define TEST_BLOCK_SIZE 20
+#define TEST_HANDLE 3
+
+static std::string make_bucket(const size_t& position, const size_t& version, const size_t& bucket_size)
+{
+    std::string bucket(bucket_size, (char)(position * 31 + version * 7));
+    memcpy(&bucket[0], &position, sizeof(position));
+    memcpy(&bucket[sizeof(position)], &version, sizeof(version));
+    return bucket;
+}
+
+/* The snapshot of the test tree, as the manifest names it. */
+static std::string snapshot_name(const std::string& directory)
+{
+    std::ifstream manifest(directory + "/" + SNAPSHOT_MANIFEST);
+    uint64_t handle;
+    std::string name;
+    while (manifest >> handle >> name) {
+        if (handle == TEST_HANDLE) {
+            return name;
+        }
+    }
+    return std::string();
+}
+
+/**
+ * Leaves behind the journal of a checkpoint that stopped before applying it, or while writing it if it is
+ * not complete.
+ */
+static void write_journal(
+    const std::string& path, const std::map<size_t, std::string>& buckets, const size_t& bucket_size, const bool& complete)
+{
+    JournalHeader header;
+    memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    header.count = buckets.size();
+    header.bucket_size = bucket_size;
+
+    std::string journal((const char*)&header, sizeof(header));
+    for (auto iter = buckets.begin(); iter != buckets.end(); iter++) {
+        const uint64_t position = iter->first;
+        journal.append((const char*)&position, sizeof(position));
+        journal.append(iter->second);
+    }
+    if (complete) {
+        journal.append(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    } else {
+        journal.resize(journal.size() - bucket_size / 2);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(journal.data(), journal.size());
+}
+
+/* Restore the directory and compare the test tree with the expected buckets. */
+static bool check_restore(const std::string& directory, const std::vector<std::string>& expected)
+{
+    SnapshotDirectory snapshots(directory);
+    auto trees = snapshots.restore(false);
+    if (trees.size() != 1 || trees.count(TEST_HANDLE) == 0 || trees[TEST_HANDLE].first != "test") {
+        return false;
+    }
+
+    const MemoryBucketStore& store = *trees[TEST_HANDLE].second;
+    bool ok = store.size() == expected.size();
+    std::string bucket(store.bucket_size(), '\0');
+    for (size_t i = 0; ok && i < store.size(); i++) {
+        store.read(i, &bucket[0]);
+        ok &= bucket == expected[i];
+    }
+    // Applied or not, a journal is gone once the tree is restored.
+    ok &= !std::filesystem::exists(directory + "/" + snapshot_name(directory) + ".journal");
+    return ok;
+}
+
+static bool report(const std::string& name, const bool& ok)
+{
+    printf("%s: %s\n", name.c_str(), ok ? "OK" : "FAILED");
+    return ok;
+}
+
+int main(int argc, const char** argv)
+{
+    const std::string directory = (std::filesystem::temp_directory_path() / "test_snapshots").string();
+    std::filesystem::remove_all(directory);
+
+    std::vector<std::string> expected;
+    size_t bucket_size;
+    {
+        // As at startup, the directory is restored, here to nothing, before the first checkpoint.
+        SnapshotDirectory snapshots(directory);
+        snapshots.restore(false);
+        MemoryBucketStore store(TEST_BUCKETS, TEST_SLOTS, TEST_BLOCK_SIZE);
+        bucket_size = store.bucket_size();
+        for (size_t i = 0; i < TEST_BUCKETS; i++) {
+            expected.push_back(make_bucket(i, 0, bucket_size));
+            store.write(i, expected[i]);
+        }
+        snapshots.save(TEST_HANDLE, "test", store);
+        snapshots.commit();
+
+        // An incremental checkpoint goes through the journal.
+        const size_t dirty[] = { 0, 5, 14 };
+        for (const size_t& position : dirty) {
+            expected[position] = make_bucket(position, 1, bucket_size);
+            store.write(position, expected[position]);
+        }
+        snapshots.save(TEST_HANDLE, "test", store);
+        snapshots.commit();
+    }
+    bool ok = report("checkpoint", check_restore(directory, expected));
+
+    // Whatever the manifest does not list is removed.
+    std::ofstream(directory + "/" + std::to_string(TEST_HANDLE) + ".99.snapshot") << "left over";
+    ok &= report("left-over snapshot", check_restore(directory, expected)
+            && !std::filesystem::exists(directory + "/" + std::to_string(TEST_HANDLE) + ".99.snapshot"));
+
+    // A complete journal is applied at restore, as the checkpoint would have done.
+    const std::string journal_path = directory + "/" + snapshot_name(directory) + ".journal";
+    std::map<size_t, std::string> journal;
+    journal[2] = make_bucket(2, 2, bucket_size);
+    journal[9] = make_bucket(9, 2, bucket_size);
+    write_journal(journal_path, journal, bucket_size, true);
+    expected[2] = journal[2];
+    expected[9] = journal[9];
+    ok &= report("complete journal", check_restore(directory, expected));
+
+    // A torn journal means that the snapshot was never touched, so it is dropped.
+    journal.clear();
+    journal[4] = make_bucket(4, 3, bucket_size);
+    journal[9] = make_bucket(9, 3, bucket_size);
+    write_journal(journal_path, journal, bucket_size, false);
+    ok &= report("torn journal", check_restore(directory, expected));
+
+    std::filesystem::remove_all(directory);
+    return ok ? 0 : 1;
+}
@@ -17,6 +17,7 @@
 
 #include <utils.h>
 
+#include <cerrno>
 #include <cmath>
 #include <cstring>
 #include <fstream>
@@ -27,6 +28,8 @@
 #include <sodium.h>
 #include <sstream>
 #include <stdexcept>
+#include <system_error>
+#include <unistd.h>
 
 #include <plog/Log.h>
 
@@ -136,6 +139,59 @@ get_bits(const unsigned int& base, const unsigned int& number, const unsigned in
     return { most, rest };
 }
 
+int get_bucket_position(const int& leaf, const int& level, const int& num_levels)
+{
+    return (1 << level) - 1 + (leaf >> (num_levels - level - 1));
+}
+
+int get_num_levels(const size_t& num_buckets)
+{
+    int num_levels = 0;
+    while (((size_t)1 << num_levels) - 1 < num_buckets) {
+        num_levels++;
+    }
+    return num_levels;
+}
+
+void read_fully(const int& fd, char* buffer, const size_t& size, const size_t& offset)
+{
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t result = pread(fd, buffer + done, size - done, offset + done);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        } else if (result <= 0) {
+            throw std::system_error(result < 0 ? errno : EIO, std::generic_category(), "Cannot read the file");
+        }
+        done += result;
+    }
+}
+
+void write_fully(const int& fd, const char* buffer, const size_t& size, const size_t& offset)
+{
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t result = pwrite(fd, buffer + done, size - done, offset + done);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        } else if (result <= 0) {
+            throw std::system_error(result < 0 ? errno : EIO, std::generic_category(), "Cannot write the file");
+        }
+        done += result;
+    }
+}
+
+int get_reverse_lexicographic_leaf(const unsigned int& g, const int& num_levels)
+{
+    const unsigned int num_leaves = 1 << (num_levels - 1);
+    const unsigned int counter = g % num_leaves;
+    int leaf = 0;
+    for (int i = 0; i < num_levels - 1; i++) {
+        leaf |= ((counter >> i) & 1) << (num_levels - 2 - i);
+    }
+    return leaf;
+}
+
 std::string
 read_keycert(std::string_view file_path)
 {